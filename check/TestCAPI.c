@@ -1,11 +1,14 @@
 #include "interfaces/highs_c_api.h"
 
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 // Force asserts to be checked always.
 #undef NDEBUG
 #include <assert.h>
 
+#include "HConfig.h"
+
 void minimal_api() {
   int numcol = 2;
   int numrow = 2;
@@ -84,9 +87,105 @@ void options() {
   Highs_destroy(highs);
 }
 
+int interruptCallback(const int callback_type,
+                      const HighsCallbackDataOut* data_out,
+                      void* user_callback_data) {
+  int* num_callback = (int*)user_callback_data;
+  (*num_callback)++;
+  return 1;
+}
+
+void callback() {
+  void* highs = Highs_create();
+
+  double cc[2] = {1.0, -2.0};
+  double cl[2] = {0.0, 0.0};
+  double cu[2] = {10.0, 10.0};
+  double rl[2] = {0.0, 0.0};
+  double ru[2] = {2.0, 1.0};
+  int astart[3] = {0, 2, 4};
+  int aindex[4] = {0, 1, 0, 1};
+  double avalue[4] = {1.0, 2.0, 1.0, 3.0};
+
+  assert( Highs_addCols(highs, 2, cc, cl, cu, 0, NULL, NULL, NULL) );
+  assert( Highs_addRows(highs, 2, rl, ru,  4, astart, aindex, avalue) );
+  Highs_setHighsStringOptionValue(highs, "presolve", "off");
+
+  // The callback requests an interrupt at the first rebuild
+  int num_callback = 0;
+  Highs_setCallback(highs, interruptCallback, &num_callback);
+  Highs_run(highs);
+  assert( num_callback == 1 );
+  assert( Highs_getModelStatus(highs, 0) == 15 );
+
+  // Clearing the callback allows the LP to be solved
+  Highs_setCallback(highs, NULL, NULL);
+  Highs_run(highs);
+  assert( Highs_getModelStatus(highs, 0) == 9 );
+
+  Highs_destroy(highs);
+}
+
+void mip() {
+  void* highs = Highs_create();
+  assert( Highs_readModel(highs, HIGHS_DIR "/check/instances/flugpl.mps") == 0 );
+  Highs_setHighsIntOptionValue(highs, "message_level", 0);
+  int numcol = Highs_getNumCols(highs);
+  double* cv = (double*)malloc(sizeof(double) * numcol);
+  double* cd = (double*)malloc(sizeof(double) * numcol);
+  double* rv = (double*)malloc(sizeof(double) * Highs_getNumRows(highs));
+  double* rd = (double*)malloc(sizeof(double) * Highs_getNumRows(highs));
+  double* pool_cv = (double*)malloc(sizeof(double) * numcol);
+  int i;
+
+  // The best solution in the pool is the optimal solution of the MIP
+  assert( Highs_runMip(highs) == 0 );
+  assert( Highs_getModelStatus(highs, 0) == 9 );
+  int num_solution = Highs_getNumMipSolutions(highs);
+  assert( num_solution > 0 );
+  double objective;
+  assert( Highs_getMipSolution(highs, 0, &objective, pool_cv) == 0 );
+  assert( objective == Highs_getObjectiveValue(highs) );
+  Highs_getSolution(highs, cv, cd, rv, rd);
+  for (i = 0; i < numcol; i++) assert( cv[i] == pool_cv[i] );
+  assert( Highs_getMipSolution(highs, num_solution, &objective, pool_cv) == 2 );
+
+  int mip_node_count;
+  double mip_dual_bound;
+  Highs_getHighsIntInfoValue(highs, "mip_node_count", &mip_node_count);
+  Highs_getHighsDoubleInfoValue(highs, "mip_dual_bound", &mip_dual_bound);
+  assert( mip_node_count > 0 );
+  assert( fabs(mip_dual_bound - objective) <= 1e-6 * fabs(objective) );
+
+  // An interrupt requested before the MIP solve stops it
+  Highs_requestInterrupt(highs);
+  assert( Highs_runMip(highs) == 1 );
+  assert( Highs_getModelStatus(highs, 0) == 15 );
+
+  // A callback requesting an interrupt stops the MIP solve, which can
+  // then be completed once the callback is cleared
+  int num_callback = 0;
+  Highs_setCallback(highs, interruptCallback, &num_callback);
+  assert( Highs_runMip(highs) == 1 );
+  assert( num_callback == 1 );
+  assert( Highs_getModelStatus(highs, 0) == 15 );
+  Highs_setCallback(highs, NULL, NULL);
+  assert( Highs_runMip(highs) == 0 );
+  assert( Highs_getModelStatus(highs, 0) == 9 );
+
+  free(cv);
+  free(cd);
+  free(rv);
+  free(rd);
+  free(pool_cv);
+  Highs_destroy(highs);
+}
+
 int main() {
   minimal_api();
   full_api();
   options();
+  callback();
+  mip();
   return 0;
 }
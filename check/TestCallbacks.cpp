@@ -0,0 +1,104 @@
+#include "HConfig.h"
+#include "Highs.h"
+#include "catch.hpp"
+#include "lp_data/HConst.h"
+
+const bool dev_run = false;
+
+struct CallbackCount {
+  int num_callback[HIGHS_CALLBACK_COUNT];
+  int interrupt_after;
+};
+
+// Counts calls of each type and requests an interrupt once
+// interrupt_after calls have been made (never if negative)
+static int countingCallback(const int callback_type,
+                            const HighsCallbackDataOut* data_out,
+                            void* user_callback_data) {
+  CallbackCount* count = (CallbackCount*)user_callback_data;
+  count->num_callback[callback_type]++;
+  if (dev_run)
+    printf("Callback %d: time %g; simplex %d; ipm %d; objective %g\n",
+           callback_type, data_out->running_time,
+           data_out->simplex_iteration_count, data_out->ipm_iteration_count,
+           data_out->objective_function_value);
+  if (count->interrupt_after < 0) return 0;
+  int total_num_callback = 0;
+  for (int type = 0; type < HIGHS_CALLBACK_COUNT; type++)
+    total_num_callback += count->num_callback[type];
+  return total_num_callback >= count->interrupt_after;
+}
+
+static void clearCount(CallbackCount& count, const int interrupt_after) {
+  for (int type = 0; type < HIGHS_CALLBACK_COUNT; type++)
+    count.num_callback[type] = 0;
+  count.interrupt_after = interrupt_after;
+}
+
+TEST_CASE("callback-simplex", "[highs_callbacks]") {
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  Highs highs;
+  if (!dev_run) highs.setHighsOptionValue("output_flag", false);
+  highs.setHighsOptionValue("presolve", "off");
+  REQUIRE(highs.readModel(filename) == HighsStatus::OK);
+
+  CallbackCount count;
+
+  // Callback that never interrupts is called at each rebuild
+  clearCount(count, -1);
+  highs.setCallback(countingCallback, &count);
+  REQUIRE(highs.run() == HighsStatus::OK);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::OPTIMAL);
+  REQUIRE(count.num_callback[HIGHS_CALLBACK_SIMPLEX_REBUILD] > 0);
+
+  // Callback that interrupts at the first rebuild
+  clearCount(count, 1);
+  highs.setBasis();
+  REQUIRE(highs.run() == HighsStatus::Warning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::REACHED_INTERRUPT);
+  REQUIRE(count.num_callback[HIGHS_CALLBACK_SIMPLEX_REBUILD] == 1);
+
+  // Clearing the callback allows the LP to be solved
+  highs.setCallback(NULL);
+  highs.setBasis();
+  REQUIRE(highs.run() == HighsStatus::OK);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::OPTIMAL);
+}
+
+TEST_CASE("callback-request-interrupt", "[highs_callbacks]") {
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  Highs highs;
+  if (!dev_run) highs.setHighsOptionValue("output_flag", false);
+  highs.setHighsOptionValue("presolve", "off");
+  REQUIRE(highs.readModel(filename) == HighsStatus::OK);
+
+  // An interrupt requested before run() is acted on without a callback
+  highs.requestInterrupt();
+  REQUIRE(highs.run() == HighsStatus::Warning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::REACHED_INTERRUPT);
+
+  // The interrupt is cleared once it has been acted on
+  REQUIRE(highs.run() == HighsStatus::OK);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::OPTIMAL);
+}
+
+#ifdef IPX_ON
+TEST_CASE("callback-ipm", "[highs_callbacks]") {
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  Highs highs;
+  if (!dev_run) highs.setHighsOptionValue("output_flag", false);
+  highs.setHighsOptionValue("presolve", "off");
+  highs.setHighsOptionValue("solver", "ipm");
+  REQUIRE(highs.readModel(filename) == HighsStatus::OK);
+
+  CallbackCount count;
+  clearCount(count, 2);
+  highs.setCallback(countingCallback, &count);
+  REQUIRE(highs.run() == HighsStatus::Warning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::REACHED_INTERRUPT);
+  REQUIRE(count.num_callback[HIGHS_CALLBACK_IPM_ITERATION] == 2);
+}
+#endif
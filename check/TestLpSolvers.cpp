@@ -430,3 +430,143 @@ TEST_CASE("dual-objective-upper-bound", "[highs_lp_solver]") {
   if (dev_run) printf("\nOptimal objective value error = %g\n", error);
   REQUIRE(error < 1e-14);
 }
+
+TEST_CASE("simplex-perturbation-strategy", "[highs_lp_solver]") {
+  // Solve a degenerate LP with dual and primal simplex using cost and
+  // adaptive perturbation, checking that the optimal objective is
+  // unaffected and that the stall statistics are consistent
+  HighsStatus status;
+  const double optimal_objective_function_value = 5501.84588831;
+  HighsOptions options;
+  Highs highs(options);
+  if (!dev_run) {
+    highs.setHighsLogfile();
+    highs.setHighsOutput();
+  }
+  const HighsInfo& info = highs.getHighsInfo();
+
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
+  status = highs.readModel(filename);
+  REQUIRE(status == HighsStatus::OK);
+
+  const int simplex_strategy[2] = {
+      (int)SimplexStrategy::SIMPLEX_STRATEGY_DUAL_PLAIN,
+      (int)SimplexStrategy::SIMPLEX_STRATEGY_PRIMAL};
+  const int perturbation_strategy[2] = {SIMPLEX_PERTURBATION_STRATEGY_COST,
+                                        SIMPLEX_PERTURBATION_STRATEGY_ADAPTIVE};
+  int degenerate_iteration_count[2][2];
+  for (int solver = 0; solver < 2; solver++) {
+    status =
+        highs.setHighsOptionValue("simplex_strategy", simplex_strategy[solver]);
+    REQUIRE(status == HighsStatus::OK);
+    for (int strategy = 0; strategy < 2; strategy++) {
+      status = highs.setHighsOptionValue("simplex_perturbation_strategy",
+                                         perturbation_strategy[strategy]);
+      REQUIRE(status == HighsStatus::OK);
+      // Force HiGHS to start from a logical basis
+      status = highs.setBasis();
+      REQUIRE(status == HighsStatus::OK);
+
+      status = highs.run();
+      REQUIRE(status == HighsStatus::OK);
+      REQUIRE(highs.getModelStatus() == HighsModelStatus::OPTIMAL);
+
+      const double error = fabs((info.objective_function_value -
+                                 optimal_objective_function_value) /
+                                optimal_objective_function_value);
+      if (dev_run)
+        printf(
+            "Simplex strategy %d; perturbation strategy %d: %d iterations, "
+            "%d degenerate, max stall %d, %d re-perturbations; objective "
+            "error %g\n",
+            simplex_strategy[solver], perturbation_strategy[strategy],
+            info.simplex_iteration_count,
+            info.simplex_degenerate_iteration_count,
+            info.simplex_max_stall_length, info.simplex_reperturbation_count,
+            error);
+      REQUIRE(error < 1e-10);
+      REQUIRE(info.simplex_max_stall_length <=
+              info.simplex_degenerate_iteration_count);
+      if (perturbation_strategy[strategy] ==
+          SIMPLEX_PERTURBATION_STRATEGY_COST)
+        REQUIRE(info.simplex_reperturbation_count == 0);
+      degenerate_iteration_count[solver][strategy] =
+          info.simplex_degenerate_iteration_count;
+    }
+  }
+  // Perturbing the bounds reduces the number of degenerate primal
+  // simplex iterations
+  REQUIRE(degenerate_iteration_count[1][1] < degenerate_iteration_count[1][0]);
+}
+
+TEST_CASE("simplex-stall-reperturbation", "[highs_lp_solver]") {
+  // Solve a 100x100 assignment LP, whose few distinct costs make it
+  // highly dual degenerate, with the dual simplex. Cost perturbation
+  // alone leaves long runs of degenerate iterations that adaptive
+  // perturbation breaks by re-perturbing the costs
+  const int n = 100;
+  HighsLp lp;
+  lp.numCol_ = n * n;
+  lp.numRow_ = 2 * n;
+  lp.colLower_.assign(lp.numCol_, 0);
+  lp.colUpper_.assign(lp.numCol_, HIGHS_CONST_INF);
+  lp.rowLower_.assign(lp.numRow_, 1);
+  lp.rowUpper_.assign(lp.numRow_, 1);
+  unsigned int seed = 1;
+  lp.Astart_.push_back(0);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      seed = seed * 1103515245 + 12345;
+      lp.colCost_.push_back(1 + (seed >> 16) % 3);
+      lp.Aindex_.push_back(i);
+      lp.Avalue_.push_back(1);
+      lp.Aindex_.push_back(n + j);
+      lp.Avalue_.push_back(1);
+      lp.Astart_.push_back(lp.Aindex_.size());
+    }
+  }
+  HighsStatus status;
+  const int perturbation_strategy[2] = {SIMPLEX_PERTURBATION_STRATEGY_COST,
+                                        SIMPLEX_PERTURBATION_STRATEGY_ADAPTIVE};
+  double objective_function_value[2];
+  int degenerate_iteration_count[2];
+  int reperturbation_count[2];
+  for (int strategy = 0; strategy < 2; strategy++) {
+    // Solve each case from scratch so that neither depends on the
+    // other
+    Highs highs;
+    if (!dev_run) {
+      highs.setHighsLogfile();
+      highs.setHighsOutput();
+    }
+    const HighsInfo& info = highs.getHighsInfo();
+    status = highs.passModel(lp);
+    REQUIRE(status == HighsStatus::OK);
+    status = highs.setHighsOptionValue(
+        "simplex_strategy", (int)SimplexStrategy::SIMPLEX_STRATEGY_DUAL_PLAIN);
+    REQUIRE(status == HighsStatus::OK);
+    status = highs.setHighsOptionValue("simplex_perturbation_strategy",
+                                       perturbation_strategy[strategy]);
+    REQUIRE(status == HighsStatus::OK);
+    status = highs.run();
+    REQUIRE(status == HighsStatus::OK);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::OPTIMAL);
+    if (dev_run)
+      printf(
+          "Perturbation strategy %d: %d iterations, %d degenerate, max "
+          "stall %d, %d re-perturbations; objective %g\n",
+          perturbation_strategy[strategy], info.simplex_iteration_count,
+          info.simplex_degenerate_iteration_count,
+          info.simplex_max_stall_length, info.simplex_reperturbation_count,
+          info.objective_function_value);
+    objective_function_value[strategy] = info.objective_function_value;
+    degenerate_iteration_count[strategy] =
+        info.simplex_degenerate_iteration_count;
+    reperturbation_count[strategy] = info.simplex_reperturbation_count;
+  }
+  REQUIRE(fabs(objective_function_value[1] - objective_function_value[0]) <
+          1e-8 * fabs(objective_function_value[0]));
+  REQUIRE(reperturbation_count[0] == 0);
+  REQUIRE(reperturbation_count[1] > 0);
+  REQUIRE(degenerate_iteration_count[1] < degenerate_iteration_count[0]);
+}
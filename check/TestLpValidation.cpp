@@ -58,7 +58,8 @@ TEST_CASE("LP-validation", "[highs_data]") {
   //  reportLp(lp, 2);
 
   const double my_infinity = 1e30;
-  HighsModelObject hmo(lp, options, timer);
+  HighsCallback callback;
+  HighsModelObject hmo(lp, options, timer, callback);
   HighsSimplexInterface hsi(hmo);
 
   return_status =
@@ -0,0 +1,205 @@
+#include <cstdio>
+
+#include "HConfig.h"
+#include "Highs.h"
+#include "catch.hpp"
+#include "mip/HighsMipCheckpoint.h"
+#include "mip/HighsMipSolver.h"
+
+const bool dev_run = false;
+
+static void setMipOptions(HighsOptions& options) {
+  options.mip = true;
+  if (!dev_run) options.message_level = ML_NONE;
+}
+
+// A multi-dimensional knapsack MIP whose sub-MIPs need branching
+static void knapsackMip(HighsLp& lp, const int num_col, const int num_row) {
+  lp.numCol_ = num_col;
+  lp.numRow_ = num_row;
+  lp.colCost_.resize(num_col);
+  lp.colLower_.assign(num_col, 0);
+  lp.colUpper_.assign(num_col, 1);
+  lp.integrality_.assign(num_col, 1);
+  lp.Astart_.push_back(0);
+  unsigned int seed = 1;
+  for (int iCol = 0; iCol < num_col; iCol++) {
+    double weight = 0;
+    for (int iRow = 0; iRow < num_row; iRow++) {
+      seed = seed * 1103515245 + 12345;
+      const double value = (seed >> 16) % 100 + 1;
+      lp.Aindex_.push_back(iRow);
+      lp.Avalue_.push_back(value);
+      weight += value;
+    }
+    lp.colCost_[iCol] = -(int)(weight / num_row) - 10;
+    lp.Astart_.push_back(lp.Aindex_.size());
+  }
+  lp.rowLower_.assign(num_row, -HIGHS_CONST_INF);
+  lp.rowUpper_.assign(num_row, 50 * num_col / 2);
+}
+
+struct CheckpointReads {
+  std::string checkpoint_file;
+  int num_read;
+};
+
+// Counts the node solves after which the checkpoint file can be read
+static int checkpointReadCallback(const int callback_type,
+                                  const HighsCallbackDataOut* data_out,
+                                  void* user_callback_data) {
+  CheckpointReads* reads = (CheckpointReads*)user_callback_data;
+  HighsMipCheckpoint checkpoint;
+  if (callback_type == HIGHS_CALLBACK_MIP_NODE_SOLVED &&
+      checkpoint.read(reads->checkpoint_file))
+    reads->num_read++;
+  return 0;
+}
+
+struct NodeInterrupt {
+  int interrupt_after_node;
+  int mip_node_count;
+};
+
+// Interrupts the first node LP solved after interrupt_after_node
+// nodes, recording the node count when the interrupt is requested
+static int nodeInterruptCallback(const int callback_type,
+                                 const HighsCallbackDataOut* data_out,
+                                 void* user_callback_data) {
+  NodeInterrupt* interrupt = (NodeInterrupt*)user_callback_data;
+  if (callback_type == HIGHS_CALLBACK_MIP_NODE_SOLVED) {
+    interrupt->mip_node_count = data_out->mip_node_count;
+    return 0;
+  }
+  return callback_type == HIGHS_CALLBACK_SIMPLEX_REBUILD &&
+         interrupt->mip_node_count >= interrupt->interrupt_after_node;
+}
+
+TEST_CASE("mip-checkpoint-resume", "[highs_mip]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/flugpl.mps";
+  std::string checkpoint_file = "flugpl.checkpoint";
+  std::remove(checkpoint_file.c_str());
+
+  HighsOptions options;
+  setMipOptions(options);
+  Highs highs(options);
+  if (!dev_run) {
+    highs.setHighsLogfile();
+    highs.setHighsOutput();
+  }
+  REQUIRE(highs.readModel(filename) == HighsStatus::OK);
+  const HighsLp& lp = highs.getLp();
+
+  // Solve the MIP without stopping
+  HighsMipSolver full_solver(options, lp);
+  full_solver.runMipSolver();
+  const double optimal_objective = full_solver.getBestObjective();
+  REQUIRE(optimal_objective < HIGHS_CONST_INF);
+
+  // Stop the search after a few nodes, writing a checkpoint
+  HighsOptions checkpoint_options;
+  setMipOptions(checkpoint_options);
+  checkpoint_options.mip_max_nodes = 10;
+  checkpoint_options.mip_checkpoint_file = checkpoint_file;
+  HighsMipSolver checkpoint_solver(checkpoint_options, lp);
+  REQUIRE(checkpoint_solver.runMipSolver() == HighsMipStatus::kMaxNodeReached);
+
+  // Resume the search from the checkpoint
+  HighsOptions resume_options;
+  setMipOptions(resume_options);
+  resume_options.mip_resume_file = checkpoint_file;
+  HighsMipSolver resume_solver(resume_options, lp);
+  resume_solver.runMipSolver();
+  REQUIRE(resume_solver.getBestObjective() == optimal_objective);
+
+  // A checkpoint that can't be read means that the search starts
+  // afresh
+  std::remove(checkpoint_file.c_str());
+  HighsMipSolver fresh_solver(resume_options, lp);
+  fresh_solver.runMipSolver();
+  REQUIRE(fresh_solver.getBestObjective() == optimal_objective);
+}
+
+TEST_CASE("mip-checkpoint-sub-mip", "[highs_mip]") {
+  std::string checkpoint_file = "knapsack.checkpoint";
+  std::remove(checkpoint_file.c_str());
+
+  HighsOptions options;
+  setMipOptions(options);
+  HighsLp lp;
+  knapsackMip(lp, 20, 3);
+
+  HighsMipSolver full_solver(options, lp);
+  full_solver.runMipSolver();
+  const double optimal_objective = full_solver.getBestObjective();
+
+  // With the maximum heuristic effort, sub-MIPs are solved during the
+  // search. The checkpoint interval is much longer than the search,
+  // so the checkpoint file should only be written when the search
+  // stops, and not by any sub-MIP
+  HighsOptions checkpoint_options;
+  setMipOptions(checkpoint_options);
+  checkpoint_options.mip_heuristic_effort = 1;
+  checkpoint_options.mip_max_nodes = 50;
+  checkpoint_options.mip_checkpoint_file = checkpoint_file;
+  CheckpointReads reads;
+  reads.checkpoint_file = checkpoint_file;
+  reads.num_read = 0;
+  HighsMipSolver checkpoint_solver(checkpoint_options, lp);
+  checkpoint_solver.setCallback(checkpointReadCallback, &reads);
+  REQUIRE(checkpoint_solver.runMipSolver() == HighsMipStatus::kMaxNodeReached);
+  REQUIRE(reads.num_read == 0);
+
+  // Resume the search from the checkpoint, with the sub-MIPs solved
+  // afresh rather than from the checkpoint
+  HighsOptions resume_options;
+  setMipOptions(resume_options);
+  resume_options.mip_heuristic_effort = 1;
+  resume_options.mip_resume_file = checkpoint_file;
+  HighsMipSolver resume_solver(resume_options, lp);
+  resume_solver.runMipSolver();
+  REQUIRE(resume_solver.getBestObjective() == optimal_objective);
+  std::remove(checkpoint_file.c_str());
+}
+
+TEST_CASE("mip-checkpoint-interrupted-node", "[highs_mip]") {
+  std::string checkpoint_file = "knapsack-interrupted.checkpoint";
+  std::remove(checkpoint_file.c_str());
+
+  HighsOptions options;
+  setMipOptions(options);
+  HighsLp lp;
+  knapsackMip(lp, 20, 3);
+
+  HighsMipSolver full_solver(options, lp);
+  full_solver.runMipSolver();
+  const double optimal_objective = full_solver.getBestObjective();
+
+  // Interrupt a node LP, so the node is abandoned when the search
+  // stops. It's not counted as solved, and it's written to the
+  // checkpoint with its parent's basis, like every other open node
+  HighsOptions checkpoint_options;
+  setMipOptions(checkpoint_options);
+  checkpoint_options.mip_checkpoint_file = checkpoint_file;
+  NodeInterrupt interrupt;
+  interrupt.interrupt_after_node = 20;
+  interrupt.mip_node_count = 0;
+  HighsMipSolver checkpoint_solver(checkpoint_options, lp);
+  checkpoint_solver.setCallback(nodeInterruptCallback, &interrupt);
+  REQUIRE(checkpoint_solver.runMipSolver() == HighsMipStatus::kInterrupted);
+
+  HighsMipCheckpoint checkpoint;
+  REQUIRE(checkpoint.read(checkpoint_file));
+  REQUIRE(checkpoint.num_nodes_solved == interrupt.mip_node_count);
+  REQUIRE(!checkpoint.node.empty());
+  for (const HighsCheckpointNode& node : checkpoint.node)
+    REQUIRE(node.basis >= 0);
+
+  HighsOptions resume_options;
+  setMipOptions(resume_options);
+  resume_options.mip_resume_file = checkpoint_file;
+  HighsMipSolver resume_solver(resume_options, lp);
+  resume_solver.runMipSolver();
+  REQUIRE(resume_solver.getBestObjective() == optimal_objective);
+  std::remove(checkpoint_file.c_str());
+}
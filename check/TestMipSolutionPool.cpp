@@ -0,0 +1,87 @@
+#include <cmath>
+
+#include "HConfig.h"
+#include "Highs.h"
+#include "catch.hpp"
+
+const bool dev_run = false;
+
+static double objectiveValue(const HighsLp& lp,
+                             const std::vector<double>& col_value) {
+  double objective = lp.offset_;
+  for (int iCol = 0; iCol < lp.numCol_; iCol++)
+    objective += lp.colCost_[iCol] * col_value[iCol];
+  return objective;
+}
+
+TEST_CASE("mip-solution-pool", "[highs_mip]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/flugpl.mps";
+  HighsOptions options;
+  if (!dev_run) options.message_level = ML_NONE;
+  Highs highs(options);
+  if (!dev_run) {
+    highs.setHighsLogfile();
+    highs.setHighsOutput();
+  }
+  REQUIRE(highs.readModel(filename) == HighsStatus::OK);
+  const HighsLp& lp = highs.getLp();
+  REQUIRE(highs.getNumMipSolutions() == 0);
+
+  REQUIRE(highs.runMip() == HighsStatus::OK);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::OPTIMAL);
+  const int num_solution = highs.getNumMipSolutions();
+  REQUIRE(num_solution > 1);
+  double objective;
+  std::vector<double> col_value;
+  std::vector<std::vector<double>> pool_col_value;
+  double previous_objective = -HIGHS_CONST_INF;
+  for (int index = 0; index < num_solution; index++) {
+    REQUIRE(highs.getMipSolution(index, objective, col_value) ==
+            HighsStatus::OK);
+    REQUIRE((int)col_value.size() == lp.numCol_);
+    REQUIRE(objective >= previous_objective);
+    REQUIRE(std::fabs(objective - objectiveValue(lp, col_value)) <=
+            1e-6 * std::max(1.0, std::fabs(objective)));
+    previous_objective = objective;
+    // The best solution is the solution of the MIP
+    if (index == 0) {
+      REQUIRE(objective == highs.getHighsInfo().objective_function_value);
+      REQUIRE(col_value == highs.getSolution().col_value);
+    }
+    // The integer values of the solutions are distinct
+    for (const std::vector<double>& other_col_value : pool_col_value) {
+      bool same = true;
+      for (int iCol = 0; iCol < lp.numCol_; iCol++)
+        if (lp.integrality_[iCol] &&
+            std::round(col_value[iCol]) != std::round(other_col_value[iCol]))
+          same = false;
+      REQUIRE(!same);
+    }
+    pool_col_value.push_back(col_value);
+  }
+  REQUIRE(highs.getMipSolution(num_solution, objective, col_value) ==
+          HighsStatus::Error);
+
+  // With a pool of one solution, it's the best one
+  const double best_objective = pool_col_value.empty()
+                                    ? HIGHS_CONST_INF
+                                    : objectiveValue(lp, pool_col_value[0]);
+  REQUIRE(highs.setHighsOptionValue("mip_pool_size", 1) == HighsStatus::OK);
+  REQUIRE(highs.runMip() == HighsStatus::OK);
+  REQUIRE(highs.getNumMipSolutions() == 1);
+  REQUIRE(highs.getMipSolution(0, objective, col_value) == HighsStatus::OK);
+  REQUIRE(std::fabs(objective - best_objective) <=
+          1e-6 * std::max(1.0, std::fabs(best_objective)));
+
+  // Only solutions with the best objective are admitted with a zero
+  // gap
+  REQUIRE(highs.setHighsOptionValue("mip_pool_size", 10) == HighsStatus::OK);
+  REQUIRE(highs.setHighsOptionValue("mip_pool_gap", 0.0) == HighsStatus::OK);
+  REQUIRE(highs.runMip() == HighsStatus::OK);
+  for (int index = 0; index < highs.getNumMipSolutions(); index++) {
+    REQUIRE(highs.getMipSolution(index, objective, col_value) ==
+            HighsStatus::OK);
+    REQUIRE(std::fabs(objective - best_objective) <=
+            1e-6 * std::max(1.0, std::fabs(best_objective)));
+  }
+}
@@ -0,0 +1,506 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "HConfig.h"
+#include "Highs.h"
+#include "catch.hpp"
+#include "lp_data/HighsSolve.h"
+#include "mip/HighsMipSolver.h"
+#include "simplex/HighsSimplexInterface.h"
+#ifdef OPENMP
+#include "omp.h"
+#endif
+
+const bool dev_run = false;
+
+// The number of threads used by the tests of the parallel tree search
+const int num_test_thread = 4;
+
+static void setMipOptions(HighsOptions& options) {
+  options.mip = true;
+  if (!dev_run) options.message_level = ML_NONE;
+}
+
+// A pure integer MIP with a random number of general integer columns
+// and sparse rows, each a knapsack or covering constraint
+static void randomMip(HighsLp& lp, unsigned int seed) {
+  auto random = [&seed](const int n) {
+    seed = seed * 1103515245 + 12345;
+    return (int)((seed >> 16) % n);
+  };
+  const int num_col = 15 + random(16);
+  const int num_row = 5 + random(8);
+  lp.numCol_ = num_col;
+  lp.numRow_ = num_row;
+  lp.colCost_.resize(num_col);
+  lp.colLower_.assign(num_col, 0);
+  lp.colUpper_.resize(num_col);
+  lp.integrality_.assign(num_col, 1);
+  std::vector<std::vector<int>> value(num_row, std::vector<int>(num_col, 0));
+  for (int iCol = 0; iCol < num_col; iCol++) {
+    lp.colCost_[iCol] = -1 - random(12);
+    lp.colUpper_[iCol] = 1 + random(6);
+    for (int iRow = 0; iRow < num_row; iRow++)
+      if (random(3) == 0) value[iRow][iCol] = random(15) - 5;
+  }
+  lp.rowLower_.assign(num_row, -HIGHS_CONST_INF);
+  lp.rowUpper_.assign(num_row, HIGHS_CONST_INF);
+  for (int iRow = 0; iRow < num_row; iRow++) {
+    double positive_activity = 0;
+    double activity = 0;
+    for (int iCol = 0; iCol < num_col; iCol++) {
+      activity += value[iRow][iCol] * lp.colUpper_[iCol];
+      if (value[iRow][iCol] > 0)
+        positive_activity += value[iRow][iCol] * lp.colUpper_[iCol];
+    }
+    if (random(3) == 0) {
+      lp.rowLower_[iRow] = std::floor(activity / 4);
+    } else {
+      lp.rowUpper_[iRow] = std::floor(positive_activity / 2);
+    }
+  }
+  lp.Astart_.assign(1, 0);
+  for (int iCol = 0; iCol < num_col; iCol++) {
+    for (int iRow = 0; iRow < num_row; iRow++) {
+      if (!value[iRow][iCol]) continue;
+      lp.Aindex_.push_back(iRow);
+      lp.Avalue_.push_back(value[iRow][iCol]);
+    }
+    lp.Astart_.push_back(lp.Aindex_.size());
+  }
+}
+
+// A random MIP with singleton rows, which presolve turns into
+// bounds, and fixed columns, which it removes
+static void presolveMip(HighsLp& lp, unsigned int seed) {
+  randomMip(lp, seed);
+  auto random = [&seed](const int n) {
+    seed = seed * 1103515245 + 12345;
+    return (int)((seed >> 16) % n);
+  };
+  const HighsLp mip = lp;
+  lp.Astart_.assign(1, 0);
+  lp.Aindex_.clear();
+  lp.Avalue_.clear();
+  for (int iCol = 0; iCol < lp.numCol_; iCol++) {
+    for (int k = mip.Astart_[iCol]; k < mip.Astart_[iCol + 1]; k++) {
+      lp.Aindex_.push_back(mip.Aindex_[k]);
+      lp.Avalue_.push_back(mip.Avalue_[k]);
+    }
+    const int reduction = random(6);
+    if (reduction < 2 && lp.colUpper_[iCol] > 1) {
+      // The row 2x <= 2u-1 implies the bound x <= u-1
+      lp.Aindex_.push_back(lp.numRow_++);
+      lp.Avalue_.push_back(2);
+      lp.rowLower_.push_back(-HIGHS_CONST_INF);
+      lp.rowUpper_.push_back(2 * lp.colUpper_[iCol] - 1);
+    } else if (reduction == 2) {
+      lp.colLower_[iCol] = random(2);
+      lp.colUpper_[iCol] = lp.colLower_[iCol];
+    }
+    lp.Astart_.push_back(lp.Aindex_.size());
+  }
+}
+
+// Bin packing with identical bins, whose permutations are symmetries
+// of the MIP. Column b*num_item+i is 1 if item i is in bin b, and
+// column num_bin*num_item+b is 1 if bin b is used
+static void binPackingMip(HighsLp& lp, unsigned int seed) {
+  auto random = [&seed](const int n) {
+    seed = seed * 1103515245 + 12345;
+    return (int)((seed >> 16) % n);
+  };
+  const int num_item = 6 + random(4);
+  const int num_bin = 3 + random(2);
+  const int capacity = 20;
+  std::vector<int> weight(num_item);
+  for (int iItem = 0; iItem < num_item; iItem++) weight[iItem] = 5 + random(9);
+  lp.numCol_ = num_bin * num_item + num_bin;
+  lp.numRow_ = num_item + num_bin;
+  lp.colCost_.assign(num_bin * num_item, 0);
+  lp.colCost_.resize(lp.numCol_, 1);
+  lp.colLower_.assign(lp.numCol_, 0);
+  lp.colUpper_.assign(lp.numCol_, 1);
+  lp.integrality_.assign(lp.numCol_, 1);
+  // Each item is in one bin, and the items in a bin fit if it's used
+  lp.rowLower_.assign(num_item, 1);
+  lp.rowUpper_.assign(num_item, 1);
+  lp.rowLower_.resize(lp.numRow_, -HIGHS_CONST_INF);
+  lp.rowUpper_.resize(lp.numRow_, 0);
+  lp.Astart_.assign(1, 0);
+  for (int iBin = 0; iBin < num_bin; iBin++) {
+    for (int iItem = 0; iItem < num_item; iItem++) {
+      lp.Aindex_.push_back(iItem);
+      lp.Avalue_.push_back(1);
+      lp.Aindex_.push_back(num_item + iBin);
+      lp.Avalue_.push_back(weight[iItem]);
+      lp.Astart_.push_back(lp.Aindex_.size());
+    }
+  }
+  for (int iBin = 0; iBin < num_bin; iBin++) {
+    lp.Aindex_.push_back(num_item + iBin);
+    lp.Avalue_.push_back(-capacity);
+    lp.Astart_.push_back(lp.Aindex_.size());
+  }
+}
+
+static void readMip(const std::string& model, HighsLp& lp) {
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+  Highs highs;
+  if (!dev_run) {
+    highs.setHighsLogfile();
+    highs.setHighsOutput();
+  }
+  REQUIRE(highs.readModel(filename) == HighsStatus::OK);
+  lp = highs.getLp();
+}
+
+// The MIPs in check/instances and some random MIPs
+static std::vector<HighsLp> testMips(const int num_random) {
+  std::vector<HighsLp> lps(2);
+  readMip("flugpl", lps[0]);
+  readMip("small_mip", lps[1]);
+  for (int seed = 0; seed < num_random; seed++) {
+    lps.push_back(HighsLp());
+    randomMip(lps.back(), seed);
+  }
+  return lps;
+}
+
+static bool equalObjective(const double objective0, const double objective1) {
+  // Infeasible MIPs have an infinite objective
+  if (objective0 == objective1) return true;
+  return std::fabs(objective0 - objective1) <=
+         1e-6 * std::max(1.0, std::fabs(objective0));
+}
+
+static double mipObjective(const HighsOptions& options, const HighsLp& lp) {
+  HighsMipSolver solver(options, lp);
+  solver.runMipSolver();
+  return solver.getBestObjective();
+}
+
+// Solves each MIP with and without a feature, which mustn't change
+// the optimal objective. Returns the number of MIPs whose search is
+// changed by the feature, so that a test can check that it acts
+static int featureObjective(const HighsOptions& options,
+                            const HighsOptions& feature_off_options,
+                            const std::vector<HighsLp>& lps) {
+  int num_search_changed = 0;
+  for (const HighsLp& lp : lps) {
+    HighsMipSolver solver(options, lp);
+    solver.runMipSolver();
+    HighsMipSolver feature_off_solver(feature_off_options, lp);
+    feature_off_solver.runMipSolver();
+    if (dev_run)
+      printf("Objective %g (%d nodes) and without feature %g (%d nodes)\n",
+             solver.getBestObjective(), solver.getNumNodesSolved(),
+             feature_off_solver.getBestObjective(),
+             feature_off_solver.getNumNodesSolved());
+    REQUIRE(equalObjective(solver.getBestObjective(),
+                           feature_off_solver.getBestObjective()));
+    if (solver.getNumNodesSolved() != feature_off_solver.getNumNodesSolved())
+      num_search_changed++;
+  }
+  return num_search_changed;
+}
+
+TEST_CASE("mip-heuristics-objective", "[highs_mip]") {
+  // Dives change the bounds of the node LP, which must be restored
+  // before the next node is solved, so the heuristics mustn't change
+  // the optimal objective
+  HighsOptions options;
+  setMipOptions(options);
+  HighsOptions feature_off_options = options;
+  feature_off_options.mip_heuristic_effort = 0;
+  REQUIRE(featureObjective(options, feature_off_options, testMips(40)) > 0);
+}
+
+struct ThreadCallbacks {
+  std::atomic<int> num_active_call{0};
+  std::atomic<bool> concurrent_call{false};
+  std::mutex mutex;
+  std::set<std::thread::id> rebuild_thread;
+  int mip_node_count = 0;
+  int interrupt_after_node;
+};
+
+// Records the threads whose LP rebuilds are reported, and whether
+// the callback is ever called concurrently. Once enough nodes have
+// been solved, the LPs of the workers are interrupted
+static int threadCallback(const int callback_type,
+                          const HighsCallbackDataOut* data_out,
+                          void* user_callback_data) {
+  ThreadCallbacks* callbacks = (ThreadCallbacks*)user_callback_data;
+  if (callbacks->num_active_call++ > 0) callbacks->concurrent_call = true;
+  if (callback_type == HIGHS_CALLBACK_MIP_NODE_SOLVED)
+    callbacks->mip_node_count = data_out->mip_node_count;
+  bool interrupt = false;
+  if (callback_type == HIGHS_CALLBACK_SIMPLEX_REBUILD) {
+    std::lock_guard<std::mutex> lock(callbacks->mutex);
+    callbacks->rebuild_thread.insert(std::this_thread::get_id());
+    interrupt = callbacks->mip_node_count >= callbacks->interrupt_after_node;
+  }
+  callbacks->num_active_call--;
+  return interrupt;
+}
+
+TEST_CASE("mip-threads-objective", "[highs_mip]") {
+  // Node LPs solved in deterministic rounds or asynchronously by
+  // several workers mustn't change the optimal objective
+#ifdef OPENMP
+  const int max_threads = omp_get_max_threads();
+  omp_set_num_threads(num_test_thread);
+#endif
+  HighsOptions options;
+  setMipOptions(options);
+  HighsOptions thread_options = options;
+  thread_options.mip_threads = num_test_thread;
+  for (const HighsLp& lp : testMips(10)) {
+    const double objective = mipObjective(options, lp);
+    for (const bool deterministic : {true, false}) {
+      thread_options.mip_deterministic = deterministic;
+      REQUIRE(equalObjective(objective, mipObjective(thread_options, lp)));
+    }
+  }
+#ifdef OPENMP
+  omp_set_num_threads(max_threads);
+#endif
+}
+
+TEST_CASE("mip-threads-callback", "[highs_mip]") {
+  // In the asynchronous search, the LPs of every worker report to the
+  // user callback, which is never called concurrently, and an
+  // interrupt stops them all
+#ifdef OPENMP
+  const int max_threads = omp_get_max_threads();
+  omp_set_num_threads(num_test_thread);
+#endif
+  HighsOptions options;
+  setMipOptions(options);
+  options.mip_threads = num_test_thread;
+  options.mip_deterministic = false;
+  HighsLp lp;
+  readMip("flugpl", lp);
+  ThreadCallbacks callbacks;
+  callbacks.interrupt_after_node = 20;
+  HighsMipSolver solver(options, lp);
+  solver.setCallback(threadCallback, &callbacks);
+  REQUIRE(solver.runMipSolver() == HighsMipStatus::kInterrupted);
+  REQUIRE(!callbacks.concurrent_call);
+  REQUIRE(solver.getNumNodesSolved() >= callbacks.interrupt_after_node);
+  REQUIRE(solver.getNumNodesSolved() <=
+          callbacks.interrupt_after_node + num_test_thread);
+#ifdef OPENMP
+  REQUIRE((int)callbacks.rebuild_thread.size() > 1);
+  omp_set_num_threads(max_threads);
+#endif
+}
+
+TEST_CASE("mip-sub-mip-silent", "[highs_mip]") {
+  // Only the MIP solver itself, and not its sub-MIPs, writes the
+  // banner
+  FILE* output = tmpfile();
+  REQUIRE(output != NULL);
+  HighsOptions options;
+  options.mip = true;
+  options.output = output;
+  options.message_level = ML_MINIMAL;
+  options.mip_report_level = 0;
+  HighsLp lp;
+  readMip("flugpl", lp);
+  HighsMipSolver solver(options, lp);
+  solver.runMipSolver();
+  rewind(output);
+  const std::string banner = "Running HiGHS MIP solver";
+  char line[256];
+  int num_banner = 0;
+  while (fgets(line, sizeof(line), output) != NULL)
+    if (std::string(line).find(banner) != std::string::npos) num_banner++;
+  fclose(output);
+  REQUIRE(num_banner == 1);
+}
+
+TEST_CASE("mip-strong-branching", "[highs_mip]") {
+  // Strong branching trials that run to optimality give the optimal
+  // objective of their child LP, whatever the order of the trials,
+  // and the optimal basis of the parent LP is restored
+  HighsLp lp;
+  readMip("flugpl", lp);
+  HighsOptions options;
+  if (!dev_run) {
+    options.message_level = ML_NONE;
+    options.output = NULL;
+    options.logfile = NULL;
+  }
+  HighsTimer timer;
+  HighsCallback callback;
+  HighsModelObject hmo(lp, options, timer, callback);
+  REQUIRE(solveLp(hmo, "Solving the LP relaxation") == HighsStatus::OK);
+  REQUIRE(hmo.scaled_model_status_ == HighsModelStatus::OPTIMAL);
+  const double objective =
+      hmo.unscaled_solution_params_.objective_function_value;
+  std::vector<int> col;
+  std::vector<double> value;
+  for (int iCol = 0; iCol < lp.numCol_; iCol++) {
+    const double col_value = hmo.solution_.col_value[iCol];
+    if (lp.integrality_[iCol] &&
+        std::fabs(col_value - std::round(col_value)) > 1e-6) {
+      col.push_back(iCol);
+      value.push_back(col_value);
+    }
+  }
+  const int num_candidate = col.size();
+  REQUIRE(num_candidate > 1);
+
+  // Solve the trials to optimality with the candidates in order and
+  // then reversed
+  const int iteration_limit = 1000;
+  std::vector<HighsModelStatus> status[2][2];
+  std::vector<double> trial_objective[2][2];
+  HighsSimplexInterface interface(hmo);
+  for (int order = 0; order < 2; order++) {
+    for (int up = 0; up < 2; up++) {
+      status[order][up].resize(num_candidate);
+      trial_objective[order][up].resize(num_candidate);
+    }
+    int iteration_count;
+    REQUIRE(interface.strongBranch(
+                num_candidate, &col[0], &value[0], iteration_limit,
+                &status[order][0][0], &trial_objective[order][0][0],
+                &status[order][1][0], &trial_objective[order][1][0],
+                iteration_count) == HighsStatus::OK);
+    REQUIRE(iteration_count > 0);
+    std::reverse(col.begin(), col.end());
+    std::reverse(value.begin(), value.end());
+  }
+  for (int ix = 0; ix < num_candidate; ix++) {
+    const int iCol = col[ix];
+    for (int up = 0; up < 2; up++) {
+      HighsLp child_lp = lp;
+      if (up) {
+        child_lp.colLower_[iCol] = std::ceil(value[ix]);
+      } else {
+        child_lp.colUpper_[iCol] = std::floor(value[ix]);
+      }
+      Highs highs;
+      if (!dev_run) {
+        highs.setHighsLogfile();
+        highs.setHighsOutput();
+      }
+      REQUIRE(highs.passModel(child_lp) == HighsStatus::OK);
+      REQUIRE(highs.run() == HighsStatus::OK);
+      const HighsModelStatus child_status = highs.getModelStatus();
+      const double child_objective =
+          highs.getHighsInfo().objective_function_value;
+      if (dev_run)
+        printf("Column %2d %4s: child LP objective %g\n", iCol,
+               up ? "up" : "down", child_objective);
+      const int reverse_ix = num_candidate - 1 - ix;
+      for (int order = 0; order < 2; order++) {
+        const int trial = order ? reverse_ix : ix;
+        REQUIRE(status[order][up][trial] == child_status);
+        if (child_status == HighsModelStatus::OPTIMAL)
+          REQUIRE(equalObjective(child_objective,
+                                 trial_objective[order][up][trial]));
+      }
+    }
+  }
+
+  // The parent LP is still optimal
+  const int simplex_iteration_count = hmo.iteration_counts_.simplex;
+  REQUIRE(solveLp(hmo, "Solving the LP relaxation again") ==
+          HighsStatus::OK);
+  REQUIRE(hmo.scaled_model_status_ == HighsModelStatus::OPTIMAL);
+  REQUIRE(hmo.iteration_counts_.simplex == simplex_iteration_count);
+  REQUIRE(equalObjective(
+      objective, hmo.unscaled_solution_params_.objective_function_value));
+}
+
+TEST_CASE("mip-domain-propagation-objective", "[highs_mip]") {
+  // Propagation only removes values that no integer feasible solution
+  // of the node can take
+  HighsOptions options;
+  setMipOptions(options);
+  HighsOptions feature_off_options = options;
+  feature_off_options.mip_domain_propagation = false;
+  REQUIRE(featureObjective(options, feature_off_options, testMips(20)) > 0);
+}
+
+TEST_CASE("mip-root-cuts-objective", "[highs_mip]") {
+  // Gomory, cover and MIR cuts are valid for every integer feasible
+  // solution, so only tighten the LP relaxation
+  HighsOptions options;
+  setMipOptions(options);
+  HighsOptions feature_off_options = options;
+  feature_off_options.mip_root_cut_rounds = 0;
+  REQUIRE(featureObjective(options, feature_off_options, testMips(20)) > 0);
+}
+
+TEST_CASE("mip-reduced-cost-fixing-objective", "[highs_mip]") {
+  // Reduced cost fixing only removes values that can't give an
+  // integer feasible solution better than the incumbent
+  HighsOptions options;
+  setMipOptions(options);
+  HighsOptions feature_off_options = options;
+  feature_off_options.mip_reduced_cost_fixing = false;
+  REQUIRE(featureObjective(options, feature_off_options, testMips(20)) > 0);
+}
+
+TEST_CASE("mip-presolve-objective", "[highs_mip]") {
+  // Presolve keeps at least one optimal integer solution, and
+  // postsolve recovers the objective of the original MIP
+  HighsOptions options;
+  setMipOptions(options);
+  HighsOptions feature_off_options = options;
+  feature_off_options.mip_presolve = false;
+  std::vector<HighsLp> lps = testMips(20);
+  for (int seed = 0; seed < 10; seed++) {
+    lps.push_back(HighsLp());
+    presolveMip(lps.back(), seed);
+  }
+  REQUIRE(featureObjective(options, feature_off_options, lps) > 0);
+}
+
+TEST_CASE("mip-conflict-analysis-objective", "[highs_mip]") {
+  // Conflicts are derived from infeasible or cut off node LPs, so are
+  // only violated by solutions that are infeasible or no better than
+  // the incumbent
+  HighsOptions options;
+  setMipOptions(options);
+  HighsOptions feature_off_options = options;
+  feature_off_options.mip_conflict_analysis = false;
+  REQUIRE(featureObjective(options, feature_off_options, testMips(20)) > 0);
+}
+
+TEST_CASE("mip-symmetry-objective", "[highs_mip]") {
+  // Orbital fixing only removes solutions that are symmetric to ones
+  // that remain. Without cuts, bin packing MIPs aren't solved at the
+  // root, so their symmetries are used
+  HighsOptions options;
+  setMipOptions(options);
+  options.mip_root_cut_rounds = 0;
+  HighsOptions feature_off_options = options;
+  feature_off_options.mip_symmetry = false;
+  std::vector<HighsLp> lps = testMips(20);
+  for (int seed = 0; seed < 10; seed++) {
+    lps.push_back(HighsLp());
+    binPackingMip(lps.back(), seed);
+  }
+  REQUIRE(featureObjective(options, feature_off_options, lps) > 0);
+}
+
+TEST_CASE("mip-branching-penalty-objective", "[highs_mip]") {
+  // Branching penalties are lower bounds on the objective of each
+  // child LP, so only prune children no better than the incumbent
+  HighsOptions options;
+  setMipOptions(options);
+  HighsOptions feature_off_options = options;
+  feature_off_options.mip_branching_penalty = false;
+  REQUIRE(featureObjective(options, feature_off_options, testMips(20)) > 0);
+}
@@ -73,6 +73,15 @@ class Highs {
    */
   HighsStatus run();
 
+  /**
+   * @brief Solves the model as a MIP with the MIP solver, keeping the
+   * best distinct integer feasible solutions found in a pool of at
+   * most mip_pool_size solutions. The model status, the best solution
+   * and its objective value, the number of nodes solved and the dual
+   * bound are then available as for an LP
+   */
+  HighsStatus runMip();
+
   /**
    * @brief writes the current solution to a file
    */
@@ -190,6 +199,19 @@ class Highs {
    */
   const HighsSolution& getSolution() const;
 
+  /**
+   * @brief Returns the number of solutions in the MIP solution pool
+   */
+  int getNumMipSolutions() const { return mip_pool_objective_.size(); }
+
+  /**
+   * @brief Gets the objective and column values of a solution in the
+   * MIP solution pool. The solutions are in increasing order of
+   * objective, so solution 0 is the best
+   */
+  HighsStatus getMipSolution(const int index, double& objective,
+                             std::vector<double>& col_value) const;
+
   /**
    * @brief Returns the HighsBasis
    */
@@ -749,6 +771,24 @@ class Highs {
    */
   HighsStatus clearSolver();
 
+  /**
+   * @brief Sets the user callback, invoked at simplex rebuilds, IPM
+   * iterations and MIP node completions. A NULL callback clears
+   * it. A nonzero return from the callback interrupts the solve. May
+   * be called from any thread, but not from within the callback.
+   */
+  HighsStatus setCallback(
+      HighsCallbackFunctionType user_callback,  //!< The callback function
+      void* user_callback_data = NULL  //!< Passed back to the callback
+  );
+
+  /**
+   * @brief Requests that the current (or next) solve stops at the
+   * next opportunity, with model status REACHED_INTERRUPT. May be
+   * called from any thread.
+   */
+  HighsStatus requestInterrupt();
+
 #ifdef HiGHSDEV
   /**
    * @brief Report the model status, solution and basis vector sizes and basis
@@ -782,6 +822,12 @@ class Highs {
   HighsOptions options_;
   HighsInfo info_;
 
+  HighsCallback callback_;
+
+  // The solutions in the pool of the last MIP solve
+  std::vector<double> mip_pool_objective_;
+  std::vector<std::vector<double>> mip_pool_solution_;
+
   // Have copies in the HiGHS class so that const references to them
   // can be passed back, regardless of whether there is a HMO, or not,
   // and also to make objective_value and iteration_count independent
@@ -800,6 +846,13 @@ class Highs {
 
   HighsStatus runLpSolver(const int model_index, const string message);
 
+  // Re-solve the LP with the dual simplex method after changes to
+  // column bounds, starting from the simplex basis and INVERT of the
+  // previous solve. Unlike run(), there is no presolve, transition or
+  // reporting. If there is no simplex basis and INVERT, run() is
+  // called.
+  HighsStatus resolveDual();
+
   PresolveComponent presolve_;
   HighsPresolveStatus runPresolve();
   HighsPostsolveStatus runPostsolve();
@@ -326,6 +326,11 @@ static int processSolve(gamshighs_t* gh) {
       gmoModelStatSet(gmo, gmoModelStat_NoSolutionReturned);
       gmoSolveStatSet(gmo, gmoSolveStat_Iteration);
       break;
+
+    case HighsModelStatus::REACHED_INTERRUPT:
+      gmoModelStatSet(gmo, gmoModelStat_NoSolutionReturned);
+      gmoSolveStatSet(gmo, gmoSolveStat_User);
+      break;
   }
 
   if (writesol) {
@@ -59,6 +59,21 @@ void Highs_destroy(void* highs) { delete (Highs*)highs; }
 
 int Highs_run(void* highs) { return (int)((Highs*)highs)->run(); }
 
+int Highs_runMip(void* highs) { return (int)((Highs*)highs)->runMip(); }
+
+int Highs_getNumMipSolutions(void* highs) {
+  return ((Highs*)highs)->getNumMipSolutions();
+}
+
+int Highs_getMipSolution(void* highs, const int index, double* objective,
+                         double* colvalue) {
+  std::vector<double> col_value;
+  HighsStatus status =
+      ((Highs*)highs)->getMipSolution(index, *objective, col_value);
+  for (int i = 0; i < (int)col_value.size(); i++) colvalue[i] = col_value[i];
+  return (int)status;
+}
+
 int Highs_readModel(void* highs, const char* filename) {
   return (int)((Highs*)highs)->readModel(std::string(filename));
 }
@@ -297,6 +312,15 @@ double Highs_getHighsRunTime(void* highs) {
   return (double)((Highs*)highs)->getHighsRunTime();
 }
 
+int Highs_setCallback(void* highs, HighsCallbackFunctionType user_callback,
+                      void* user_callback_data) {
+  return (int)((Highs*)highs)->setCallback(user_callback, user_callback_data);
+}
+
+int Highs_requestInterrupt(void* highs) {
+  return (int)((Highs*)highs)->requestInterrupt();
+}
+
 int Highs_addRow(void* highs, const double lower, const double upper,
                  const int num_new_nz, const int* indices,
                  const double* values) {
@@ -10,6 +10,8 @@
 #ifndef HIGHS_C_API
 #define HIGHS_C_API
 
+#include "lp_data/HighsCallbackStruct.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -84,6 +86,33 @@ int Highs_runQuiet(void* highs  //!< HiGHS object reference
 int Highs_run(void* highs  //!< HiGHS object reference
 );
 
+/**
+ * @brief Solves the model as a MIP, keeping the best distinct integer
+ * feasible solutions found in a pool of at most mip_pool_size
+ * solutions. The model status, best solution and info are then
+ * available as for an LP
+ */
+int Highs_runMip(void* highs  //!< HiGHS object reference
+);
+
+/**
+ * @brief Returns the number of solutions in the MIP solution pool
+ */
+int Highs_getNumMipSolutions(void* highs  //!< HiGHS object reference
+);
+
+/**
+ * @brief Gets the objective and column values of a solution in the
+ * MIP solution pool, where solution 0 is the best
+ */
+int Highs_getMipSolution(
+    void* highs,        //!< HiGHS object reference
+    const int index,    //!< Index of the solution in the pool
+    double* objective,  //!< The objective of the solution
+    double* colvalue    //!< array of length [numcol], filled with column
+                        //!< values
+);
+
 /*
  * @brief Reports the solution and basis status
  */
@@ -349,6 +378,24 @@ int Highs_setLogicalBasis(void* highs  //!< HiGHS object reference
 double Highs_getHighsRunTime(void* highs  //!< HiGHS object reference
 );
 
+/**
+ * @brief Sets the user callback, invoked at simplex rebuilds, IPM
+ * iterations and MIP node completions. A NULL callback clears it. A
+ * nonzero return from the callback interrupts the solve
+ */
+int Highs_setCallback(
+    void* highs,                              //!< HiGHS object reference
+    HighsCallbackFunctionType user_callback,  //!< The callback function
+    void* user_callback_data  //!< Passed back to the callback
+);
+
+/**
+ * @brief Requests that the current (or next) solve stops at the next
+ * opportunity. May be called from any thread
+ */
+int Highs_requestInterrupt(void* highs  //!< HiGHS object reference
+);
+
 /**
  * @brief Adds a row to the model
  */
@@ -21,6 +21,7 @@
 #include "ipm/ipx/include/ipx_status.h"
 #include "ipm/ipx/src/lp_solver.h"
 #include "lp_data/HConst.h"
+#include "lp_data/HighsCallback.h"
 #include "lp_data/HighsLp.h"
 #include "lp_data/HighsSolution.h"
 
@@ -517,8 +518,32 @@ HighsStatus analyseIpmNoProgress(const ipx::Info& ipx_info,
   }
   return HighsStatus::Warning;
 }
+// Data passed through IPX to ipxIterationCallback
+struct IpxCallbackData {
+  HighsCallback* callback;
+  HighsTimer* timer;
+  int ipm_iteration_offset;
+};
+
+ipx::Int ipxIterationCallback(ipx::Int iter, double pobjective,
+                              double presidual, double dresidual,
+                              void* callback_data) {
+  IpxCallbackData& data = *(IpxCallbackData*)callback_data;
+  HighsCallback& callback = *data.callback;
+  if (!callback.active()) return callback.interruptRequested();
+  HighsCallbackDataOut data_out;
+  HighsCallback::clearDataOut(data_out);
+  data_out.running_time = data.timer->readRunHighsClock();
+  data_out.ipm_iteration_count = data.ipm_iteration_offset + (int)iter;
+  data_out.objective_function_value = pobjective;
+  data_out.sum_primal_infeasibilities = presidual;
+  data_out.sum_dual_infeasibilities = dresidual;
+  return callback.callbackAction(HIGHS_CALLBACK_IPM_ITERATION, data_out);
+}
+
 HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
-                       const HighsLp& lp, bool& imprecise_solution,
+                       HighsCallback& callback, const HighsLp& lp,
+                       bool& imprecise_solution,
                        HighsBasis& highs_basis, HighsSolution& highs_solution,
                        HighsIterationCounts& iteration_counts,
                        HighsModelStatus& unscaled_model_status,
@@ -572,6 +597,10 @@ HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
 
   // Set the internal IPX parameters
   lps.SetParameters(parameters);
+  // Set the callback through which IPX reports its progress and
+  // picks up any interrupt
+  IpxCallbackData callback_data = {&callback, &timer, iteration_counts.ipm};
+  lps.SetIterationCallback(ipxIterationCallback, &callback_data);
 
   ipx::Int num_col, num_row;
   std::vector<ipx::Int> Ap, Ai;
@@ -656,7 +685,12 @@ HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
     // Can stop with iter limit
     // Can stop with no progress
     if (ipx_info.status_ipm == IPX_STATUS_time_limit) {
-      unscaled_model_status = HighsModelStatus::REACHED_TIME_LIMIT;
+      // IPX reports a user interrupt as reaching the time limit
+      if (callback.interruptRequested()) {
+        unscaled_model_status = HighsModelStatus::REACHED_INTERRUPT;
+      } else {
+        unscaled_model_status = HighsModelStatus::REACHED_TIME_LIMIT;
+      }
       return HighsStatus::Warning;
     } else if (ipx_info.status_ipm == IPX_STATUS_iter_limit) {
       unscaled_model_status = HighsModelStatus::REACHED_ITERATION_LIMIT;
@@ -16,10 +16,12 @@
 
 #include "ipm/IpxStatus.h"
 #include "lp_data/HConst.h"
+#include "lp_data/HighsCallback.h"
 #include "lp_data/HighsLp.h"
 
 HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
-                       const HighsLp& lp, bool& imprecise_solution,
+                       HighsCallback& callback, const HighsLp& lp,
+                       bool& imprecise_solution,
                        HighsBasis& highs_basis, HighsSolution& highs_solution,
                        HighsIterationCounts& iteration_counts,
                        HighsModelStatus& unscaled_model_status,
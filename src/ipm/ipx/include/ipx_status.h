@@ -43,6 +43,7 @@
 #define IPX_ERROR_basis_too_ill_conditioned 306
 
 #define IPX_ERROR_interrupt_time            999
+#define IPX_ERROR_interrupt_user            998
 
 #define IPX_basic                            0
 #define IPX_nonbasic                        -1
@@ -17,6 +17,20 @@ Int Control::InterruptCheck() const {
     return 0;
 }
 
+void Control::SetIterationCallback(IterationCallback callback,
+                                   void* callback_data) {
+    callback_ = callback;
+    callback_data_ = callback_data;
+}
+
+Int Control::IterationCheck(Int iter, double pobjective, double presidual,
+                            double dresidual) const {
+    if (callback_ &&
+        callback_(iter, pobjective, presidual, dresidual, callback_data_))
+        return IPX_ERROR_interrupt_user;
+    return 0;
+}
+
 std::ostream& Control::Log() const {
     return output_;
 }
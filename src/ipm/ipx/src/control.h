@@ -40,6 +40,20 @@ public:
     // Returns IPX_ERROR_* if interrupt is requested, 0 otherwise.
     Int InterruptCheck() const;
 
+    // Sets a function that is called once per IPM iteration with the
+    // iteration count, primal objective and primal and dual residuals. A
+    // nonzero return value from @callback interrupts the solver.
+    // @callback_data is passed back to @callback.
+    typedef Int (*IterationCallback)(Int iter, double pobjective,
+                                     double presidual, double dresidual,
+                                     void* callback_data);
+    void SetIterationCallback(IterationCallback callback, void* callback_data);
+
+    // Calls the iteration callback, if set. Returns IPX_ERROR_interrupt_user
+    // if it requests an interrupt, 0 otherwise.
+    Int IterationCheck(Int iter, double pobjective, double presidual,
+                       double dresidual) const;
+
     // Returns output streams for log and debugging messages. The streams
     // evaluate to false if they discard output, so that we can write
     //
@@ -104,6 +118,8 @@ private:
     mutable Timer interval_;     // time since last interval log
     mutable Multistream output_; // forwards to logfile and/or console
     mutable Multistream dummy_;  // discards everything
+    IterationCallback callback_{nullptr};
+    void* callback_data_{nullptr};
 };
 
 // Formats integer, string literal or floating point value into a string of
@@ -78,11 +78,16 @@ void IPM::Driver(KKTSolver* kkt, Iterate* iterate, Info* info) {
         MakeStep(step);
         info->iter++;
         PrintOutput();
+        if ((info->errflag = control_.IterationCheck(
+                 info->iter, iterate->pobjective_after_postproc(),
+                 iterate->presidual(), iterate->dresidual())) != 0)
+            break;
     }
 
     // Set status_ipm if errflag terminated IPM.
     if (info->errflag) {
-        if (info->errflag == IPX_ERROR_interrupt_time) {
+        if (info->errflag == IPX_ERROR_interrupt_time ||
+            info->errflag == IPX_ERROR_interrupt_user) {
             info->errflag = 0;
             info->status_ipm = IPX_STATUS_time_limit;
         } else {
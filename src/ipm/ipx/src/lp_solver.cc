@@ -110,6 +110,11 @@ void LpSolver::SetParameters(Parameters new_parameters) {
     control_.parameters(new_parameters);
 }
 
+void LpSolver::SetIterationCallback(Control::IterationCallback callback,
+                                    void* callback_data) {
+    control_.SetIterationCallback(callback, callback_data);
+}
+
 void LpSolver::ClearModel() {
     info_ = Info();
     model_.clear();
@@ -56,6 +56,11 @@ public:
     Parameters GetParameters() const;
     void SetParameters(Parameters new_parameters);
 
+    // Sets a function called once per IPM iteration. See
+    // Control::SetIterationCallback().
+    void SetIterationCallback(Control::IterationCallback callback,
+                              void* callback_data);
+
     // Discards the model and solution (if any) but keeps the parameters.
     void ClearModel();
 
@@ -61,6 +61,25 @@ enum SolverOption {
   SOLVER_OPTION_IPM
 };
 
+enum MipNodeSelection {
+  MIP_NODE_SELECTION_MIN = 0,
+  MIP_NODE_SELECTION_DEPTH_FIRST = MIP_NODE_SELECTION_MIN,
+  MIP_NODE_SELECTION_BEST_BOUND,
+  MIP_NODE_SELECTION_BEST_ESTIMATE,
+  MIP_NODE_SELECTION_HYBRID,  // Depth-first with periodic best bound
+  MIP_NODE_SELECTION_MAX = MIP_NODE_SELECTION_HYBRID
+};
+
+enum MipBranchingRule {
+  MIP_BRANCHING_RULE_MIN = 0,
+  MIP_BRANCHING_RULE_FIRST_FRACTIONAL = MIP_BRANCHING_RULE_MIN,
+  MIP_BRANCHING_RULE_MOST_FRACTIONAL,
+  MIP_BRANCHING_RULE_PSEUDOCOST,
+  MIP_BRANCHING_RULE_RELIABILITY,  // Pseudocost with strong branching
+                                   // for unreliable columns
+  MIP_BRANCHING_RULE_MAX = MIP_BRANCHING_RULE_RELIABILITY
+};
+
 enum PrimalDualStatus {
   STATUS_NOTSET = -1,
   STATUS_MIN = STATUS_NOTSET,
@@ -124,7 +143,8 @@ enum class HighsModelStatus {
   REACHED_ITERATION_LIMIT,
   PRIMAL_DUAL_INFEASIBLE,
   DUAL_INFEASIBLE,
-  HIGHS_MODEL_STATUS_MAX = DUAL_INFEASIBLE
+  REACHED_INTERRUPT,
+  HIGHS_MODEL_STATUS_MAX = REACHED_INTERRUPT
 };
 
 /** SCIP/CPLEX-like HiGHS basis status for columns and rows. */
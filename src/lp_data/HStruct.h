@@ -22,6 +22,10 @@ struct HighsIterationCounts {
   int simplex = 0;
   int ipm = 0;
   int crossover = 0;
+  // Simplex stall statistics
+  int simplex_degenerate = 0;
+  int simplex_max_stall = 0;
+  int simplex_reperturbation = 0;
 };
 
 struct HighsScale {
@@ -26,6 +26,7 @@
 #include "lp_data/HighsModelUtils.h"
 #include "lp_data/HighsSolution.h"
 #include "lp_data/HighsSolve.h"
+#include "mip/HighsMipSolver.h"
 #include "simplex/HSimplexDebug.h"
 #include "simplex/HighsSimplexInterface.h"
 #include "util/HighsMatrixPic.h"
@@ -36,7 +37,7 @@
 
 Highs::Highs() {
   hmos_.clear();
-  hmos_.push_back(HighsModelObject(lp_, options_, timer_));
+  hmos_.push_back(HighsModelObject(lp_, options_, timer_, callback_));
 }
 
 HighsStatus Highs::setHighsOptionValue(const std::string& option,
@@ -207,7 +208,7 @@ HighsStatus Highs::reset() {
   // Clear any HiGHS model object
   hmos_.clear();
   // Create a HiGHS model object for this LP
-  hmos_.push_back(HighsModelObject(lp_, options_, timer_));
+  hmos_.push_back(HighsModelObject(lp_, options_, timer_, callback_));
 
   presolve_.clear();
 
@@ -302,7 +303,7 @@ HighsStatus Highs::clearModel() {
   // Set up with an empty LP so that addrows/cols can be used to build
   //  HighsLp empty_lp; lp_ = empty_lp;
   lp_.clear();
-  hmos_.push_back(HighsModelObject(lp_, options_, timer_));
+  hmos_.push_back(HighsModelObject(lp_, options_, timer_, callback_));
   return_status =
       interpretCallStatus(this->clearSolver(), return_status, "clearSolver");
   if (return_status == HighsStatus::Error) return return_status;
@@ -571,7 +572,7 @@ basis_.valid_, hmos_[0].basis_.valid_);
         // Add reduced lp object to vector of HighsModelObject,
         // so the last one in lp_ is the presolved one.
 
-        hmos_.push_back(HighsModelObject(reduced_lp, options_, timer_));
+        hmos_.push_back(HighsModelObject(reduced_lp, options_, timer_, callback_));
         // Log the presolve reductions
         reportPresolveReductions(hmos_[original_hmo].options_,
                                  hmos_[original_hmo].lp_,
@@ -890,10 +891,81 @@ basis_.valid_, hmos_[0].basis_.valid_);
   return returnFromRun(return_status);
 }
 
+HighsStatus Highs::runMip() {
+  clearModelStatus();
+  clearSolution();
+  clearBasis();
+  clearInfo();
+  HighsMipSolver solver(options_, lp_);
+  // The MIP solver makes any callbacks, and honours any interrupt
+  // requested before the solve
+  HighsCallbackFunctionType user_callback;
+  void* user_callback_data;
+  callback_.get(user_callback, user_callback_data);
+  solver.setCallback(user_callback, user_callback_data);
+  if (callback_.interruptRequested()) solver.requestInterrupt();
+  HighsMipStatus mip_status = solver.runMipSolver();
+  const int num_solution = solver.getNumMipSolutions();
+  mip_pool_objective_.resize(num_solution);
+  mip_pool_solution_.resize(num_solution);
+  for (int index = 0; index < num_solution; index++)
+    solver.getMipSolution(index, mip_pool_objective_[index],
+                          mip_pool_solution_[index]);
+
+  model_status_ = solver.getMipModelStatus(mip_status);
+  scaled_model_status_ = model_status_;
+  // The interrupt request has been honoured, so clear it
+  if (model_status_ == HighsModelStatus::REACHED_INTERRUPT)
+    callback_.clearInterrupt();
+  const std::vector<double>& mip_solution = solver.getBestSolution();
+  if (!mip_solution.empty()) {
+    solution_.col_value = mip_solution;
+    calculateRowValues(lp_, solution_);
+    info_.primal_status = (int)PrimalDualStatus::STATUS_FEASIBLE_POINT;
+    info_.objective_function_value = solver.getBestObjective();
+  } else {
+    info_.primal_status = (int)PrimalDualStatus::STATUS_NO_SOLUTION;
+  }
+  info_.mip_node_count = solver.getNumNodesSolved();
+  info_.mip_dual_bound =
+      model_status_ == HighsModelStatus::PRIMAL_INFEASIBLE
+          ? HIGHS_CONST_INF
+          : solver.getDualBound();
+  switch (mip_status) {
+    case HighsMipStatus::kError:
+    case HighsMipStatus::kNodeError:
+    case HighsMipStatus::kRootNodeError:
+      return HighsStatus::Error;
+    case HighsMipStatus::kTimeout:
+    case HighsMipStatus::kReachedSimplexIterationLimit:
+    case HighsMipStatus::kMaxNodeReached:
+    case HighsMipStatus::kInterrupted:
+    case HighsMipStatus::kRootNodeNotOptimal:
+      return HighsStatus::Warning;
+    default:
+      return HighsStatus::OK;
+  }
+}
+
 const HighsLp& Highs::getLp() const { return lp_; }
 
 const HighsSolution& Highs::getSolution() const { return solution_; }
 
+HighsStatus Highs::getMipSolution(const int index, double& objective,
+                                  std::vector<double>& col_value) const {
+  const int num_solution = mip_pool_objective_.size();
+  if (index < 0 || index >= num_solution) {
+    HighsLogMessage(options_.logfile, HighsMessageType::ERROR,
+                    "Solution index %d out of range [0, %d] in "
+                    "getMipSolution",
+                    index, num_solution - 1);
+    return HighsStatus::Error;
+  }
+  objective = mip_pool_objective_[index];
+  col_value = mip_pool_solution_[index];
+  return HighsStatus::OK;
+}
+
 const HighsBasis& Highs::getBasis() const { return basis_; }
 
 const HighsModelStatus& Highs::getModelStatus(const bool scaled_model) const {
@@ -1711,6 +1783,17 @@ HighsStatus Highs::clearSolver() {
   return HighsStatus::OK;
 }
 
+HighsStatus Highs::setCallback(HighsCallbackFunctionType user_callback,
+                               void* user_callback_data) {
+  callback_.set(user_callback, user_callback_data);
+  return HighsStatus::OK;
+}
+
+HighsStatus Highs::requestInterrupt() {
+  callback_.requestInterrupt();
+  return HighsStatus::OK;
+}
+
 #ifdef HiGHSDEV
 void Highs::reportModelStatusSolutionBasis(const std::string message,
                                            const int hmo_ix) {
@@ -1898,6 +1981,35 @@ HighsStatus Highs::runLpSolver(const int model_index, const string message) {
   return returnFromHighs(return_status);
 }
 
+HighsStatus Highs::resolveDual() {
+  if (hmos_.size() != 1 || !lp_.numCol_ || !lp_.numRow_) return run();
+  HighsModelObject& model = hmos_[0];
+  HighsSimplexInterface interface(model);
+  if (!interface.prepareResolveDual()) return run();
+  // As in run(), the iteration counts are for this solve only
+  zeroHighsIterationCounts(info_);
+  copyHighsIterationCounts(info_, model.iteration_counts_);
+  bool run_highs_clock_already_running = timer_.runningRunHighsClock();
+  if (!run_highs_clock_already_running) timer_.startRunHighsClock();
+  HighsStatus return_status = interpretCallStatus(
+      interface.resolveDual(), HighsStatus::OK, "resolveDual");
+  if (!run_highs_clock_already_running) timer_.stopRunHighsClock();
+  copyHighsIterationCounts(model.iteration_counts_, info_);
+  if (return_status == HighsStatus::Error) {
+    model_status_ = HighsModelStatus::SOLVE_ERROR;
+    scaled_model_status_ = model_status_;
+    model.unscaled_model_status_ = model_status_;
+    model.scaled_model_status_ = model_status_;
+    return returnFromRun(return_status);
+  }
+  // Copy the status, solution and basis of the model object to HiGHS,
+  // and make them consistent as when returning from run()
+  if (!getHighsModelStatusAndInfo(0)) return returnFromRun(HighsStatus::Error);
+  solution_ = model.solution_;
+  basis_ = model.basis_;
+  return returnFromRun(return_status);
+}
+
 HighsStatus Highs::writeSolution(const std::string filename,
                                  const bool pretty) const {
   HighsStatus return_status = HighsStatus::OK;
@@ -2086,6 +2198,8 @@ void Highs::clearSolution() {
   info_.primal_status = (int)PrimalDualStatus::STATUS_NOTSET;
   info_.dual_status = (int)PrimalDualStatus::STATUS_NOTSET;
   clearSolutionUtil(solution_);
+  mip_pool_objective_.clear();
+  mip_pool_solution_.clear();
 }
 
 void Highs::clearBasis() { clearBasisUtil(basis_); }
@@ -2188,6 +2302,15 @@ HighsStatus Highs::returnFromRun(const HighsStatus run_return_status) {
         assert(model_status_ == scaled_model_status_);
         assert(return_status == HighsStatus::Warning);
         break;
+      case HighsModelStatus::REACHED_INTERRUPT:
+        clearSolution();
+        clearBasis();
+        clearInfo();
+        // The interrupt request has been honoured, so clear it
+        callback_.clearInterrupt();
+        assert(model_status_ == scaled_model_status_);
+        assert(return_status == HighsStatus::Warning);
+        break;
       case HighsModelStatus::DUAL_INFEASIBLE:
         clearSolution();
         // May have a basis, according to whether infeasibility was
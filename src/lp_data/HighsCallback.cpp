@@ -0,0 +1,57 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsCallback.cpp
+ * @brief
+ * @author Julian Hall, Ivet Galabova, Qi Huangfu and Michael Feldmeier
+ */
+#include "lp_data/HighsCallback.h"
+
+void HighsCallback::set(HighsCallbackFunctionType user_callback,
+                        void* user_callback_data) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  user_callback_ = user_callback;
+  user_callback_data_ = user_callback_data;
+  active_.store(user_callback != nullptr);
+}
+
+void HighsCallback::get(HighsCallbackFunctionType& user_callback,
+                        void*& user_callback_data) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  user_callback = user_callback_;
+  user_callback_data = user_callback_data_;
+}
+
+void HighsCallback::clearDataOut(HighsCallbackDataOut& data_out) {
+  data_out.running_time = 0;
+  data_out.simplex_iteration_count = 0;
+  data_out.ipm_iteration_count = 0;
+  data_out.objective_function_value = 0;
+  data_out.num_primal_infeasibilities = 0;
+  data_out.sum_primal_infeasibilities = 0;
+  data_out.num_dual_infeasibilities = 0;
+  data_out.sum_dual_infeasibilities = 0;
+  data_out.mip_node_count = 0;
+  data_out.mip_primal_bound = 0;
+  data_out.mip_dual_bound = 0;
+}
+
+bool HighsCallback::callbackAction(const int callback_type,
+                                   const HighsCallbackDataOut& data_out) {
+  if (active()) {
+    // Hold the lock while the user callback runs so that it can't be
+    // cleared from another thread mid-call. The user callback must
+    // not call set().
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (user_callback_ != nullptr &&
+        user_callback_(callback_type, &data_out, user_callback_data_))
+      requestInterrupt();
+  }
+  return interruptRequested();
+}
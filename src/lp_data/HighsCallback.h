@@ -0,0 +1,65 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsCallback.h
+ * @brief User callback and cooperative interrupt for HiGHS solvers
+ * @author Julian Hall, Ivet Galabova, Qi Huangfu and Michael Feldmeier
+ */
+#ifndef LP_DATA_HIGHS_CALLBACK_H_
+#define LP_DATA_HIGHS_CALLBACK_H_
+
+#include <atomic>
+#include <mutex>
+
+#include "lp_data/HighsCallbackStruct.h"
+
+/**
+ * @brief Holds the user callback and the interrupt flag for one
+ * Highs instance. The callback may be set or cleared, and an
+ * interrupt requested, from any thread. Solvers test active() and
+ * interruptRequested() first, so there is no further overhead unless
+ * a callback is set or an interrupt requested.
+ */
+class HighsCallback {
+ public:
+  void set(HighsCallbackFunctionType user_callback, void* user_callback_data);
+  void get(HighsCallbackFunctionType& user_callback,
+           void*& user_callback_data);
+  bool active() const { return active_.load(std::memory_order_relaxed); }
+
+  void requestInterrupt() { interrupt_.store(true); }
+  void clearInterrupt() { interrupt_.store(false); }
+  bool interruptRequested() const {
+    return interrupt_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Zero the data to be passed to the user callback
+   */
+  static void clearDataOut(HighsCallbackDataOut& data_out);
+
+  /**
+   * @brief Call the user callback (if set) with data_out, and return
+   * true if an interrupt has been requested - either by the callback
+   * or by another thread. The data is filled in by the caller, so
+   * concurrent callers don't share it, and the user callback is
+   * never called concurrently
+   */
+  bool callbackAction(const int callback_type,
+                      const HighsCallbackDataOut& data_out);
+
+ private:
+  std::mutex mutex_;
+  HighsCallbackFunctionType user_callback_ = nullptr;
+  void* user_callback_data_ = nullptr;
+  std::atomic<bool> active_{false};
+  std::atomic<bool> interrupt_{false};
+};
+
+#endif  // LP_DATA_HIGHS_CALLBACK_H_
@@ -0,0 +1,62 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsCallbackStruct.h
+ * @brief Data passed to user callbacks. Plain C so that it can be
+ * shared by the C++ class Highs and the C API
+ * @author Julian Hall, Ivet Galabova, Qi Huangfu and Michael Feldmeier
+ */
+#ifndef LP_DATA_HIGHS_CALLBACK_STRUCT_H_
+#define LP_DATA_HIGHS_CALLBACK_STRUCT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Points in a solve at which the user callback is invoked
+ */
+typedef enum {
+  HIGHS_CALLBACK_SIMPLEX_REBUILD = 0,
+  HIGHS_CALLBACK_IPM_ITERATION,
+  HIGHS_CALLBACK_MIP_NODE_SOLVED,
+  HIGHS_CALLBACK_COUNT
+} HighsCallbackType;
+
+/*
+ * Progress data passed to the user callback. Values that are not
+ * defined for a particular callback type are zero.
+ */
+typedef struct {
+  double running_time;
+  int simplex_iteration_count;
+  int ipm_iteration_count;
+  double objective_function_value;
+  int num_primal_infeasibilities;
+  double sum_primal_infeasibilities;
+  int num_dual_infeasibilities;
+  double sum_dual_infeasibilities;
+  int mip_node_count;
+  double mip_primal_bound;
+  double mip_dual_bound;
+} HighsCallbackDataOut;
+
+/*
+ * User callback: a nonzero return value requests that the solve is
+ * interrupted
+ */
+typedef int (*HighsCallbackFunctionType)(const int callback_type,
+                                         const HighsCallbackDataOut* data_out,
+                                         void* user_callback_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // LP_DATA_HIGHS_CALLBACK_STRUCT_H_
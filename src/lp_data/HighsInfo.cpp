@@ -25,6 +25,8 @@ void HighsInfo::clear() {
   num_dual_infeasibilities = -1;
   max_dual_infeasibility = 0;
   sum_dual_infeasibilities = 0;
+  mip_node_count = -1;
+  mip_dual_bound = 0;
 }
 
 inline const char* bool2string(bool b) { return b ? "true" : "false"; }
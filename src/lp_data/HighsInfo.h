@@ -106,6 +106,9 @@ struct HighsInfoStruct {
   int simplex_iteration_count;
   int ipm_iteration_count;
   int crossover_iteration_count;
+  int simplex_degenerate_iteration_count;
+  int simplex_max_stall_length;
+  int simplex_reperturbation_count;
   int primal_status;
   int dual_status;
   double objective_function_value;
@@ -115,6 +118,8 @@ struct HighsInfoStruct {
   int num_dual_infeasibilities;
   double max_dual_infeasibility;
   double sum_dual_infeasibilities;
+  int mip_node_count;
+  double mip_dual_bound;
 };
 
 class HighsInfo : public HighsInfoStruct {
@@ -179,6 +184,24 @@ class HighsInfo : public HighsInfoStruct {
                                    &crossover_iteration_count, 0);
     records.push_back(record_int);
 
+    record_int = new InfoRecordInt(
+        "simplex_degenerate_iteration_count",
+        "Number of simplex iterations with zero step", advanced,
+        &simplex_degenerate_iteration_count, 0);
+    records.push_back(record_int);
+
+    record_int = new InfoRecordInt(
+        "simplex_max_stall_length",
+        "Maximum number of consecutive simplex iterations with zero step",
+        advanced, &simplex_max_stall_length, 0);
+    records.push_back(record_int);
+
+    record_int = new InfoRecordInt(
+        "simplex_reperturbation_count",
+        "Number of cost re-perturbations due to dual simplex stalling",
+        advanced, &simplex_reperturbation_count, 0);
+    records.push_back(record_int);
+
     record_int = new InfoRecordInt(
         "primal_status",
         "Primal status of the model: -1 => Not set; 0 => No solution; 1 => "
@@ -227,6 +250,16 @@ class HighsInfo : public HighsInfoStruct {
         "sum_dual_infeasibilities", "Sum of dual infeasibilities", advanced,
         &sum_dual_infeasibilities, 0);
     records.push_back(record_double);
+
+    record_int = new InfoRecordInt("mip_node_count",
+                                   "Number of nodes solved by the MIP solver",
+                                   advanced, &mip_node_count, -1);
+    records.push_back(record_int);
+
+    record_double = new InfoRecordDouble(
+        "mip_dual_bound", "Best bound on the optimal MIP objective value",
+        advanced, &mip_dual_bound, 0);
+    records.push_back(record_double);
   }
 
  public:
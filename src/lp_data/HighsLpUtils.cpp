@@ -2336,3 +2336,22 @@ HighsStatus calculateResidual(const HighsLp& lp, HighsSolution& solution,
 
   return status;
 }
+
+void getRowwiseMatrix(const HighsLp& lp, std::vector<int>& ar_start,
+                      std::vector<int>& ar_index,
+                      std::vector<double>& ar_value) {
+  const int num_nz = lp.Astart_[lp.numCol_];
+  ar_start.assign(lp.numRow_ + 1, 0);
+  ar_index.resize(num_nz);
+  ar_value.resize(num_nz);
+  for (int el = 0; el < num_nz; el++) ar_start[lp.Aindex_[el] + 1]++;
+  for (int row = 0; row < lp.numRow_; row++) ar_start[row + 1] += ar_start[row];
+  std::vector<int> ar_next = ar_start;
+  for (int col = 0; col < lp.numCol_; col++) {
+    for (int el = lp.Astart_[col]; el < lp.Astart_[col + 1]; el++) {
+      const int put = ar_next[lp.Aindex_[el]]++;
+      ar_index[put] = col;
+      ar_value[put] = lp.Avalue_[el];
+    }
+  }
+}
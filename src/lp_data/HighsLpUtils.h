@@ -262,4 +262,9 @@ void reportPresolveReductions(const HighsOptions& options, const HighsLp& lp,
 bool isLessInfeasibleDSECandidate(const HighsOptions& options,
                                   const HighsLp& lp);
 
+// Form a row-wise copy of the constraint matrix of an LP
+void getRowwiseMatrix(const HighsLp& lp, std::vector<int>& ar_start,
+                      std::vector<int>& ar_index,
+                      std::vector<double>& ar_value);
+
 #endif  // LP_DATA_HIGHSLPUTILS_H_
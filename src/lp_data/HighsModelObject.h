@@ -12,10 +12,12 @@
 
 #include "HConfig.h"
 #include "lp_data/HStruct.h"
+#include "lp_data/HighsCallback.h"
 #include "lp_data/HighsLp.h"
 #include "lp_data/HighsOptions.h"
 #include "simplex/HFactor.h"
 #include "simplex/HMatrix.h"
+#include "simplex/HVectorPool.h"
 #include "simplex/HighsSimplexAnalysis.h"
 #include "simplex/SimplexStruct.h"
 #include "util/HighsRandom.h"
@@ -26,12 +28,18 @@
 // include essential data.
 class HighsModelObject {
  public:
-  HighsModelObject(HighsLp& lp, HighsOptions& options, HighsTimer& timer)
-      : lp_(lp), options_(options), timer_(timer), simplex_analysis_(timer) {}
+  HighsModelObject(HighsLp& lp, HighsOptions& options, HighsTimer& timer,
+                   HighsCallback& callback)
+      : lp_(lp),
+        options_(options),
+        timer_(timer),
+        callback_(callback),
+        simplex_analysis_(timer) {}
 
   HighsLp& lp_;
   HighsOptions& options_;
   HighsTimer& timer_;
+  HighsCallback& callback_;
 
   HighsModelStatus unscaled_model_status_ = HighsModelStatus::NOTSET;
   HighsModelStatus scaled_model_status_ = HighsModelStatus::NOTSET;
@@ -49,6 +57,7 @@ class HighsModelObject {
   HighsScale scale_;
   HMatrix matrix_;
   HFactor factor_;
+  HVectorPool hvector_pool_;
   HighsSimplexAnalysis simplex_analysis_;
   HighsRandom random_;
 };
@@ -331,6 +331,9 @@ std::string utilHighsModelStatusToString(const HighsModelStatus model_status) {
     case HighsModelStatus::DUAL_INFEASIBLE:
       return "Dual infeasible";
       break;
+    case HighsModelStatus::REACHED_INTERRUPT:
+      return "Reached interrupt";
+      break;
     default:
 #ifdef HiGHSDEV
       printf("HiGHS model status %d not recognised\n", (int)model_status);
@@ -345,12 +348,18 @@ void zeroHighsIterationCounts(HighsIterationCounts& iteration_counts) {
   iteration_counts.simplex = 0;
   iteration_counts.ipm = 0;
   iteration_counts.crossover = 0;
+  iteration_counts.simplex_degenerate = 0;
+  iteration_counts.simplex_max_stall = 0;
+  iteration_counts.simplex_reperturbation = 0;
 }
 
 void zeroHighsIterationCounts(HighsInfo& info) {
   info.simplex_iteration_count = 0;
   info.ipm_iteration_count = 0;
   info.crossover_iteration_count = 0;
+  info.simplex_degenerate_iteration_count = 0;
+  info.simplex_max_stall_length = 0;
+  info.simplex_reperturbation_count = 0;
 }
 
 void copyHighsIterationCounts(const HighsIterationCounts& iteration_counts,
@@ -358,6 +367,9 @@ void copyHighsIterationCounts(const HighsIterationCounts& iteration_counts,
   info.simplex_iteration_count = iteration_counts.simplex;
   info.ipm_iteration_count = iteration_counts.ipm;
   info.crossover_iteration_count = iteration_counts.crossover;
+  info.simplex_degenerate_iteration_count = iteration_counts.simplex_degenerate;
+  info.simplex_max_stall_length = iteration_counts.simplex_max_stall;
+  info.simplex_reperturbation_count = iteration_counts.simplex_reperturbation;
 }
 
 void copyHighsIterationCounts(const HighsInfo& info,
@@ -365,6 +377,9 @@ void copyHighsIterationCounts(const HighsInfo& info,
   iteration_counts.simplex = info.simplex_iteration_count;
   iteration_counts.ipm = info.ipm_iteration_count;
   iteration_counts.crossover = info.crossover_iteration_count;
+  iteration_counts.simplex_degenerate = info.simplex_degenerate_iteration_count;
+  iteration_counts.simplex_max_stall = info.simplex_max_stall_length;
+  iteration_counts.simplex_reperturbation = info.simplex_reperturbation_count;
 }
 
 // Deduce the HighsStatus value corresponding to a HighsModelStatus value.
@@ -398,6 +413,8 @@ HighsStatus highsStatusFromHighsModelStatus(HighsModelStatus model_status) {
       return HighsStatus::Warning;
     case HighsModelStatus::REACHED_ITERATION_LIMIT:
       return HighsStatus::Warning;
+    case HighsModelStatus::REACHED_INTERRUPT:
+      return HighsStatus::Warning;
     case HighsModelStatus::DUAL_INFEASIBLE:
       return HighsStatus::Warning;
     default:
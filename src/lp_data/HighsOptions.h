@@ -274,17 +274,40 @@ struct HighsOptionsStruct {
   bool simplex_initial_condition_check;
   double simplex_initial_condition_tolerance;
   double dual_steepest_edge_weight_log_error_threshold;
+  int simplex_perturbation_strategy;
+  int simplex_stall_length_limit;
   double dual_simplex_cost_perturbation_multiplier;
+  double primal_simplex_bound_perturbation_multiplier;
   double factor_pivot_threshold;
   double factor_pivot_tolerance;
   double start_crossover_tolerance;
   bool less_infeasible_DSE_check;
   bool less_infeasible_DSE_choose_row;
+  bool approximate_initial_DSE_weights;
   bool use_original_HFactor_logic;
 
   // Options for MIP solver
   int mip_max_nodes;
   int mip_report_level;
+  int mip_node_selection;
+  int mip_best_bound_frequency;
+  int mip_branching_rule;
+  int mip_threads;
+  bool mip_deterministic;
+  bool mip_domain_propagation;
+  bool mip_reduced_cost_fixing;
+  bool mip_presolve;
+  bool mip_conflict_analysis;
+  bool mip_symmetry;
+  bool mip_branching_penalty;
+  std::string mip_checkpoint_file;
+  double mip_checkpoint_interval;
+  std::string mip_resume_file;
+  int mip_pool_size;
+  double mip_pool_gap;
+  int mip_root_cut_rounds;
+  double mip_heuristic_effort;
+  bool mip_root_concurrent;
 
   // Switch for MIP solver
   bool mip;
@@ -534,6 +557,139 @@ class HighsOptions : public HighsOptionsStruct {
                             advanced, &mip_report_level, 0, 1, 2);
     records.push_back(record_int);
 
+    record_int = new OptionRecordInt(
+        "mip_node_selection",
+        "MIP solver node selection: depth-first / best bound / best estimate "
+        "/ hybrid (0/1/2/3)",
+        advanced, &mip_node_selection, MIP_NODE_SELECTION_MIN,
+        MIP_NODE_SELECTION_DEPTH_FIRST, MIP_NODE_SELECTION_MAX);
+    records.push_back(record_int);
+
+    record_int = new OptionRecordInt(
+        "mip_best_bound_frequency",
+        "Frequency with which hybrid MIP node selection chooses the node with "
+        "the best bound",
+        advanced, &mip_best_bound_frequency, 0, 100, HIGHS_CONST_I_INF);
+    records.push_back(record_int);
+
+    record_int = new OptionRecordInt(
+        "mip_branching_rule",
+        "MIP solver branching rule: first fractional / most fractional / "
+        "pseudocost / reliability (0/1/2/3)",
+        advanced, &mip_branching_rule, MIP_BRANCHING_RULE_MIN,
+        MIP_BRANCHING_RULE_FIRST_FRACTIONAL, MIP_BRANCHING_RULE_MAX);
+    records.push_back(record_int);
+
+    record_int = new OptionRecordInt(
+        "mip_threads", "Number of threads used to solve MIP node LPs",
+        advanced, &mip_threads, 1, 1, HIGHS_THREAD_LIMIT);
+    records.push_back(record_int);
+
+    record_bool = new OptionRecordBool(
+        "mip_deterministic",
+        "Solve MIP node LPs in synchronised rounds so that parallel tree "
+        "search is deterministic",
+        advanced, &mip_deterministic, true);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_domain_propagation",
+        "Propagate the bound changes at each MIP node through the rows "
+        "before solving its LP",
+        advanced, &mip_domain_propagation, true);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_reduced_cost_fixing",
+        "Use the reduced costs of MIP node LPs and the incumbent objective "
+        "to tighten the bounds on integer variables",
+        advanced, &mip_reduced_cost_fixing, true);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_presolve",
+        "Presolve the MIP with reductions that preserve integer solutions "
+        "before solving its LP relaxation",
+        advanced, &mip_presolve, true);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_conflict_analysis",
+        "Derive conflicts from infeasible MIP node LPs and use them in "
+        "domain propagation",
+        advanced, &mip_conflict_analysis, true);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_symmetry",
+        "Detect symmetries of the MIP and use them for orbital fixing in "
+        "branch-and-bound",
+        advanced, &mip_symmetry, true);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_branching_penalty",
+        "Bound the objective of each child node LP using the tableau row "
+        "of the branching column in its parent's LP, so that children can "
+        "be pruned before their LPs are solved",
+        advanced, &mip_branching_penalty, true);
+    records.push_back(record_bool);
+
+    record_string = new OptionRecordString(
+        "mip_checkpoint_file",
+        "File to which the state of the MIP search is written periodically "
+        "and when it stops, so that it can be resumed: empty => none",
+        advanced, &mip_checkpoint_file, "");
+    records.push_back(record_string);
+
+    record_double = new OptionRecordDouble(
+        "mip_checkpoint_interval",
+        "Time in seconds between checkpoints of the MIP search", advanced,
+        &mip_checkpoint_interval, 0, 300, HIGHS_CONST_INF);
+    records.push_back(record_double);
+
+    record_string = new OptionRecordString(
+        "mip_resume_file",
+        "Checkpoint file from which the MIP search is resumed: empty => none",
+        advanced, &mip_resume_file, "");
+    records.push_back(record_string);
+
+    record_int = new OptionRecordInt(
+        "mip_pool_size",
+        "Maximum number of distinct integer feasible solutions kept in the "
+        "MIP solution pool: 0 => no pool",
+        advanced, &mip_pool_size, 0, 10, HIGHS_CONST_I_INF);
+    records.push_back(record_int);
+
+    record_double = new OptionRecordDouble(
+        "mip_pool_gap",
+        "Relative gap to the best objective within which solutions are "
+        "admitted to the MIP solution pool",
+        advanced, &mip_pool_gap, 0, HIGHS_CONST_INF, HIGHS_CONST_INF);
+    records.push_back(record_double);
+
+    record_int = new OptionRecordInt(
+        "mip_root_cut_rounds",
+        "Maximum number of rounds of cuts added to the LP relaxation at the "
+        "root node of the MIP: 0 => no cuts",
+        advanced, &mip_root_cut_rounds, 0, 20, HIGHS_CONST_I_INF);
+    records.push_back(record_int);
+
+    record_double = new OptionRecordDouble(
+        "mip_heuristic_effort",
+        "Simplex iterations used by MIP primal heuristics relative to those "
+        "of the tree search: 0 => no heuristics",
+        advanced, &mip_heuristic_effort, 0, 0.05, 1);
+    records.push_back(record_double);
+
+    record_bool = new OptionRecordBool(
+        "mip_root_concurrent",
+        "When there are at least two MIP threads, run IPX, a feasibility "
+        "pump and trivial heuristics concurrently with the dual simplex "
+        "solve of the root node LP",
+        advanced, &mip_root_concurrent, true);
+    records.push_back(record_bool);
+
     // Advanced options
     advanced = true;
 
@@ -619,6 +775,21 @@ class HighsOptions : public HighsOptionsStruct {
         HIGHS_CONST_INF);
     records.push_back(record_double);
 
+    record_int = new OptionRecordInt(
+        "simplex_perturbation_strategy",
+        "Strategy for simplex perturbation: off / cost / adaptive (0/1/2)",
+        advanced, &simplex_perturbation_strategy,
+        SIMPLEX_PERTURBATION_STRATEGY_MIN, SIMPLEX_PERTURBATION_STRATEGY_COST,
+        SIMPLEX_PERTURBATION_STRATEGY_MAX);
+    records.push_back(record_int);
+
+    record_int = new OptionRecordInt(
+        "simplex_stall_length_limit",
+        "Number of consecutive degenerate dual simplex iterations after "
+        "which the adaptive perturbation strategy re-perturbs the costs",
+        advanced, &simplex_stall_length_limit, 1, 20, HIGHS_CONST_I_INF);
+    records.push_back(record_int);
+
     record_double = new OptionRecordDouble(
         "dual_simplex_cost_perturbation_multiplier",
         "Dual simplex cost perturbation multiplier: 0 => no perturbation",
@@ -626,6 +797,13 @@ class HighsOptions : public HighsOptionsStruct {
         HIGHS_CONST_INF);
     records.push_back(record_double);
 
+    record_double = new OptionRecordDouble(
+        "primal_simplex_bound_perturbation_multiplier",
+        "Primal simplex bound perturbation multiplier: 0 => no perturbation",
+        advanced, &primal_simplex_bound_perturbation_multiplier, 0.0, 1.0,
+        HIGHS_CONST_INF);
+    records.push_back(record_double);
+
     record_double = new OptionRecordDouble(
         "factor_pivot_threshold", "Matrix factorization pivot threshold",
         advanced, &factor_pivot_threshold, min_pivot_threshold,
@@ -661,6 +839,12 @@ class HighsOptions : public HighsOptionsStruct {
                              &less_infeasible_DSE_choose_row, true);
     records.push_back(record_bool);
 
+    record_bool = new OptionRecordBool(
+        "approximate_initial_DSE_weights",
+        "Compute only a sample of the initial DSE weights for large LPs",
+        advanced, &approximate_initial_DSE_weights, false);
+    records.push_back(record_bool);
+
     record_bool =
         new OptionRecordBool("mip", "Use mip solver.", advanced, &mip, false);
     records.push_back(record_bool);
@@ -189,9 +189,9 @@ HighsStatus solveLp(HighsModelObject& model, const string message) {
 #ifdef IPX_ON
     bool imprecise_solution;
     call_status = solveLpIpx(
-        options, model.timer_, model.lp_, imprecise_solution, model.basis_,
-        model.solution_, model.iteration_counts_, model.unscaled_model_status_,
-        model.unscaled_solution_params_);
+        options, model.timer_, model.callback_, model.lp_, imprecise_solution,
+        model.basis_, model.solution_, model.iteration_counts_,
+        model.unscaled_model_status_, model.unscaled_solution_params_);
     return_status =
         interpretCallStatus(call_status, return_status, "solveLpIpx");
     if (return_status == HighsStatus::Error) return return_status;
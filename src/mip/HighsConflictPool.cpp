@@ -0,0 +1,151 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsConflictPool.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "util/HighsUtils.h"
+
+void HighsConflictPool::setup(const HighsLp& mip) {
+  mip_ = &mip;
+  int num_integer = 0;
+  for (int iCol = 0; iCol < mip.numCol_; iCol++)
+    if (mip.integrality_[iCol]) num_integer++;
+  max_conflict_size_ =
+      conflict_max_size_fraction * num_integer + conflict_min_max_size;
+  start_.assign(1, 0);
+  literal_.clear();
+}
+
+bool HighsConflictPool::analyzeDualRay(
+    const HighsLp& lp, const std::vector<double>& dual_ray,
+    std::vector<HighsConflictLiteral>& conflict) const {
+  return deriveConflict(lp, dual_ray, HIGHS_CONST_INF, conflict);
+}
+
+bool HighsConflictPool::analyzeCutoff(
+    const HighsLp& lp, const std::vector<double>& row_dual,
+    const double cutoff, std::vector<HighsConflictLiteral>& conflict) const {
+  if (highs_isInfinity(cutoff)) return false;
+  return deriveConflict(lp, row_dual, cutoff, conflict);
+}
+
+bool HighsConflictPool::deriveConflict(
+    const HighsLp& lp, const std::vector<double>& multiplier,
+    const double cutoff, std::vector<HighsConflictLiteral>& conflict) const {
+  const HighsLp& mip = *mip_;
+  assert(lp.numCol_ == mip.numCol_);
+  conflict.clear();
+  double max_multiplier = 0;
+  for (int iRow = 0; iRow < lp.numRow_; iRow++)
+    max_multiplier = std::max(std::fabs(multiplier[iRow]), max_multiplier);
+  if (max_multiplier <= 0) return false;
+  const double multiplier_tolerance =
+      conflict_multiplier_tolerance * max_multiplier;
+  // With a finite cutoff, the objective row offset + c^T x <= cutoff
+  // is aggregated with the rows
+  const double objective_weight = highs_isInfinity(cutoff) ? 0 : 1;
+
+  std::vector<double> proof_value(lp.numCol_);
+  std::vector<std::pair<double, int>> relaxation;
+  // The sign convention of the multipliers depends on the row that
+  // was infeasible, or the sense of the row duals, so try both
+  for (const double sign : {1.0, -1.0}) {
+    // Aggregating the rows with multipliers y = sign * multiplier,
+    // using the bound on each row given by the sign of its
+    // multiplier, gives the inequality sum_j d_j x_j >= r, which is
+    // valid for the MIP
+    double rhs = objective_weight * (lp.offset_ - cutoff);
+    bool valid = true;
+    for (int iRow = 0; iRow < lp.numRow_; iRow++) {
+      const double y = sign * multiplier[iRow];
+      if (std::fabs(y) <= multiplier_tolerance) continue;
+      const double bound = y > 0 ? lp.rowLower_[iRow] : lp.rowUpper_[iRow];
+      if (highs_isInfinity(std::fabs(bound))) {
+        valid = false;
+        break;
+      }
+      rhs += y * bound;
+    }
+    if (!valid) continue;
+    for (int iCol = 0; iCol < lp.numCol_; iCol++) {
+      double value = -objective_weight * lp.colCost_[iCol];
+      for (int iEl = lp.Astart_[iCol]; iEl < lp.Astart_[iCol + 1]; iEl++) {
+        const double y = sign * multiplier[lp.Aindex_[iEl]];
+        if (std::fabs(y) > multiplier_tolerance) value += y * lp.Avalue_[iEl];
+      }
+      proof_value[iCol] = value;
+    }
+    // The LP is infeasible, or cut off, if the maximum of sum_j d_j x_j
+    // over the node bounds is less than r
+    double max_activity = 0;
+    for (int iCol = 0; iCol < lp.numCol_; iCol++) {
+      const double value = proof_value[iCol];
+      if (value == 0) continue;
+      const double bound = value > 0 ? lp.colUpper_[iCol] : lp.colLower_[iCol];
+      if (highs_isInfinity(std::fabs(bound))) {
+        valid = false;
+        break;
+      }
+      max_activity += value * bound;
+    }
+    if (!valid) continue;
+    const double min_violation =
+        conflict_min_violation * std::max(1.0, std::fabs(rhs));
+    if (max_activity >= rhs - min_violation) continue;
+
+    // Relax the node bounds that differ from those of the MIP, in
+    // increasing order of the resulting increase in the maximum
+    // activity, while the inequality remains violated. The bounds
+    // that can't be relaxed form the conflict.
+    relaxation.clear();
+    for (int iCol = 0; iCol < lp.numCol_; iCol++) {
+      const double value = proof_value[iCol];
+      if (value == 0) continue;
+      const double node_bound =
+          value > 0 ? lp.colUpper_[iCol] : lp.colLower_[iCol];
+      const double mip_bound =
+          value > 0 ? mip.colUpper_[iCol] : mip.colLower_[iCol];
+      if (node_bound == mip_bound) continue;
+      relaxation.push_back(
+          std::make_pair(value * (mip_bound - node_bound), iCol));
+    }
+    std::sort(relaxation.begin(), relaxation.end());
+    for (const std::pair<double, int>& relax : relaxation) {
+      if (max_activity + relax.first < rhs - min_violation) {
+        max_activity += relax.first;
+        continue;
+      }
+      const int iCol = relax.second;
+      if (!mip.integrality_[iCol] ||
+          (int)conflict.size() >= max_conflict_size_) {
+        conflict.clear();
+        return false;
+      }
+      const bool upper = proof_value[iCol] > 0;
+      conflict.push_back(
+          {iCol, upper, upper ? lp.colUpper_[iCol] : lp.colLower_[iCol]});
+    }
+    // An empty conflict would mean that the MIP is infeasible, which
+    // is left to the tree search to establish
+    return !conflict.empty();
+  }
+  return false;
+}
+
+bool HighsConflictPool::addConflict(
+    const std::vector<HighsConflictLiteral>& conflict) {
+  if (size() >= conflict_pool_max_size) return false;
+  literal_.insert(literal_.end(), conflict.begin(), conflict.end());
+  start_.push_back(literal_.size());
+  return true;
+}
@@ -0,0 +1,84 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef MIP_HIGHS_CONFLICT_POOL_H_
+#define MIP_HIGHS_CONFLICT_POOL_H_
+
+#include <vector>
+
+#include "lp_data/HighsLp.h"
+
+// The bound x_col <= value if upper is true, and x_col >= value
+// otherwise, on an integer column
+struct HighsConflictLiteral {
+  int col;
+  bool upper;
+  double value;
+};
+
+// Pool of conflicts: sets of bounds on integer columns that can't all
+// hold in a feasible solution of the MIP that improves on the
+// incumbent. A conflict is derived from the dual ray of an infeasible
+// node LP, or the row duals of a node LP that's cut off, by
+// aggregating its rows into an inequality that the node bounds
+// violate, and then keeping only the node bounds that are needed for
+// the violation.
+class HighsConflictPool {
+ public:
+  void setup(const HighsLp& mip);
+
+  // Derive a conflict from the dual ray of an infeasible LP whose
+  // columns are those of the MIP and whose rows are valid for the
+  // MIP. Returns false if the ray doesn't give a conflict that's
+  // small enough to be useful.
+  bool analyzeDualRay(const HighsLp& lp, const std::vector<double>& dual_ray,
+                      std::vector<HighsConflictLiteral>& conflict) const;
+  // Derive a conflict from the row duals of an LP whose objective
+  // can't be less than the cutoff. The conflict is only valid for
+  // solutions with objective less than the cutoff.
+  bool analyzeCutoff(const HighsLp& lp, const std::vector<double>& row_dual,
+                     const double cutoff,
+                     std::vector<HighsConflictLiteral>& conflict) const;
+
+  // Add a conflict to the pool, unless the pool is full
+  bool addConflict(const std::vector<HighsConflictLiteral>& conflict);
+
+  int size() const { return start_.size() - 1; }
+  int conflictSize(const int index) const {
+    return start_[index + 1] - start_[index];
+  }
+  const HighsConflictLiteral* conflict(const int index) const {
+    return &literal_[start_[index]];
+  }
+
+ private:
+  bool deriveConflict(const HighsLp& lp, const std::vector<double>& multiplier,
+                      const double cutoff,
+                      std::vector<HighsConflictLiteral>& conflict) const;
+
+  const HighsLp* mip_ = nullptr;
+  int max_conflict_size_ = 0;
+  std::vector<int> start_;
+  std::vector<HighsConflictLiteral> literal_;
+};
+
+// Conflicts have at most conflict_max_size_fraction times the number
+// of integer columns plus conflict_min_max_size literals, and the pool
+// holds at most conflict_pool_max_size of them, since each conflict
+// adds to the cost of propagation. Row multipliers less than
+// conflict_multiplier_tolerance times the largest are ignored, and the
+// node bounds must violate the aggregated inequality by at least
+// conflict_min_violation (relative).
+const double conflict_max_size_fraction = 0.1;
+const int conflict_min_max_size = 10;
+const int conflict_pool_max_size = 1000;
+const double conflict_multiplier_tolerance = 1e-9;
+const double conflict_min_violation = 1e-6;
+
+#endif
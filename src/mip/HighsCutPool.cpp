@@ -0,0 +1,135 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsCutPool.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+void HighsCutSet::clear() {
+  lower.clear();
+  start.clear();
+  index.clear();
+  value.clear();
+}
+
+void HighsCutPool::setup(const int num_col) {
+  cut_.clear();
+  dense_value_.assign(num_col, 0);
+}
+
+bool HighsCutPool::addCut(const std::vector<int>& index,
+                          const std::vector<double>& value,
+                          const double lower) {
+  assert(index.size() == value.size());
+  Cut cut;
+  cut.index = index;
+  cut.value = value;
+  cut.lower = lower;
+  cut.age = 0;
+  double norm_squared = 0;
+  for (double v : value) norm_squared += v * v;
+  cut.norm = std::sqrt(norm_squared);
+  if (cut.norm <= 0) return false;
+  // Look for an almost parallel cut in the pool. Since the cuts are
+  // almost parallel, the one with the larger normalised lower bound
+  // is the stronger.
+  scatter(cut);
+  int parallel_cut = -1;
+  for (int iCut = 0; iCut < (int)cut_.size(); iCut++) {
+    if (parallelism(cut_[iCut]) > cut_max_parallelism) {
+      parallel_cut = iCut;
+      break;
+    }
+  }
+  unscatter(cut);
+  if (parallel_cut >= 0) {
+    Cut& pool_cut = cut_[parallel_cut];
+    if (pool_cut.lower / pool_cut.norm >= cut.lower / cut.norm) return false;
+    pool_cut = cut;
+    return true;
+  }
+  cut_.push_back(cut);
+  return true;
+}
+
+void HighsCutPool::separate(const std::vector<double>& solution,
+                            const int max_num_cut, HighsCutSet& cut_set) {
+  // Find the violated cuts, ageing the others
+  std::vector<std::pair<double, int> > violated;
+  for (int iCut = 0; iCut < (int)cut_.size(); iCut++) {
+    const double cut_efficacy = efficacy(cut_[iCut], solution);
+    if (cut_efficacy > cut_min_efficacy) {
+      violated.push_back(std::make_pair(-cut_efficacy, iCut));
+    } else {
+      cut_[iCut].age++;
+    }
+  }
+  std::sort(violated.begin(), violated.end());
+
+  // Select the most efficacious cuts that aren't almost parallel to
+  // one that's already been selected
+  std::vector<int> selected;
+  std::vector<int> remove(cut_.size(), 0);
+  for (const std::pair<double, int>& entry : violated) {
+    if ((int)selected.size() >= max_num_cut) break;
+    const Cut& cut = cut_[entry.second];
+    bool parallel = false;
+    for (int iCut : selected) {
+      scatter(cut_[iCut]);
+      parallel = parallelism(cut) > cut_max_parallelism;
+      unscatter(cut_[iCut]);
+      if (parallel) break;
+    }
+    if (parallel) continue;
+    selected.push_back(entry.second);
+    remove[entry.second] = 1;
+    cut_set.lower.push_back(cut.lower);
+    cut_set.start.push_back(cut_set.index.size());
+    cut_set.index.insert(cut_set.index.end(), cut.index.begin(),
+                         cut.index.end());
+    cut_set.value.insert(cut_set.value.end(), cut.value.begin(),
+                         cut.value.end());
+  }
+
+  // Remove the selected cuts and those that are too old
+  int num_cut = 0;
+  for (int iCut = 0; iCut < (int)cut_.size(); iCut++) {
+    if (remove[iCut] || cut_[iCut].age >= cut_pool_age_limit) continue;
+    if (num_cut < iCut) cut_[num_cut] = std::move(cut_[iCut]);
+    num_cut++;
+  }
+  cut_.resize(num_cut);
+}
+
+double HighsCutPool::efficacy(const Cut& cut,
+                              const std::vector<double>& solution) const {
+  double activity = 0;
+  for (int ix = 0; ix < (int)cut.index.size(); ix++)
+    activity += cut.value[ix] * solution[cut.index[ix]];
+  return (cut.lower - activity) / cut.norm;
+}
+
+double HighsCutPool::parallelism(const Cut& cut) const {
+  // The workspace holds the other cut, normalised
+  double product = 0;
+  for (int ix = 0; ix < (int)cut.index.size(); ix++)
+    product += cut.value[ix] * dense_value_[cut.index[ix]];
+  return std::fabs(product) / cut.norm;
+}
+
+void HighsCutPool::scatter(const Cut& cut) {
+  for (int ix = 0; ix < (int)cut.index.size(); ix++)
+    dense_value_[cut.index[ix]] = cut.value[ix] / cut.norm;
+}
+
+void HighsCutPool::unscatter(const Cut& cut) {
+  for (int col : cut.index) dense_value_[col] = 0;
+}
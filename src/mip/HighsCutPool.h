@@ -0,0 +1,75 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef MIP_HIGHS_CUT_POOL_H_
+#define MIP_HIGHS_CUT_POOL_H_
+
+#include <vector>
+
+// Cuts selected from the pool, held row-wise with lower bounds so
+// that they can be passed to Highs::addRows
+struct HighsCutSet {
+  std::vector<double> lower;
+  std::vector<int> start;
+  std::vector<int> index;
+  std::vector<double> value;
+
+  int numCut() const { return lower.size(); }
+  void clear();
+};
+
+// Pool of cuts of the form sum_j value_j x_j >= lower. Cuts that are
+// not violated when the pool is separated age, and are discarded
+// when they are too old.
+class HighsCutPool {
+ public:
+  void setup(const int num_col);
+
+  // Add a cut to the pool, unless it's almost parallel to a cut in
+  // the pool that is at least as strong
+  bool addCut(const std::vector<int>& index, const std::vector<double>& value,
+              const double lower);
+
+  // Move the cuts violated by the solution into cut_set, in
+  // decreasing order of efficacy, omitting any cut that is almost
+  // parallel to one that has already been selected
+  void separate(const std::vector<double>& solution, const int max_num_cut,
+                HighsCutSet& cut_set);
+
+  int size() const { return cut_.size(); }
+
+ private:
+  struct Cut {
+    std::vector<int> index;
+    std::vector<double> value;
+    double lower;
+    double norm;
+    int age;
+  };
+  double efficacy(const Cut& cut, const std::vector<double>& solution) const;
+  // Cosine of the angle between a cut and the cut in the workspace
+  double parallelism(const Cut& cut) const;
+  void scatter(const Cut& cut);
+  void unscatter(const Cut& cut);
+
+  std::vector<Cut> cut_;
+  // Dense workspace for computing parallelism, zero between calls
+  std::vector<double> dense_value_;
+};
+
+// Cuts are only selected if their efficacy - the Euclidean distance
+// by which they cut off the solution - exceeds cut_min_efficacy,
+// and if the cosine of the angle between them and any cut already
+// selected is at most cut_max_parallelism. Cuts that have not been
+// violated in cut_pool_age_limit calls to separate() are discarded.
+const double cut_min_efficacy = 1e-4;
+const double cut_max_parallelism = 0.95;
+const int cut_pool_age_limit = 10;
+
+#endif
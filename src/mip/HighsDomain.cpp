@@ -0,0 +1,392 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsDomain.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "lp_data/HighsLpUtils.h"
+#include "util/HighsUtils.h"
+
+// Replace the contribution of a bound to a row activity
+static void changeContribution(double& activity, int& num_inf,
+                               const double value, const double old_bound,
+                               const double new_bound) {
+  if (highs_isInfinity(std::fabs(old_bound))) {
+    num_inf--;
+  } else {
+    activity -= value * old_bound;
+  }
+  if (highs_isInfinity(std::fabs(new_bound))) {
+    num_inf++;
+  } else {
+    activity += value * new_bound;
+  }
+}
+
+void HighsDomain::setup(const HighsLp& mip,
+                        const double feasibility_tolerance) {
+  mip_ = &mip;
+  feasibility_tolerance_ = feasibility_tolerance;
+  const int num_col = mip.numCol_;
+  const int num_row = mip.numRow_;
+
+  getRowwiseMatrix(mip, ar_start_, ar_index_, ar_value_);
+
+  // Compute the row activities for the bounds of the MIP
+  col_lower_ = mip.colLower_;
+  col_upper_ = mip.colUpper_;
+  min_activity_.assign(num_row, 0);
+  max_activity_.assign(num_row, 0);
+  num_inf_min_activity_.assign(num_row, 0);
+  num_inf_max_activity_.assign(num_row, 0);
+  for (int row = 0; row < num_row; row++) {
+    for (int el = ar_start_[row]; el < ar_start_[row + 1]; el++) {
+      const int col = ar_index_[el];
+      const double value = ar_value_[el];
+      const double min_bound = value > 0 ? col_lower_[col] : col_upper_[col];
+      const double max_bound = value > 0 ? col_upper_[col] : col_lower_[col];
+      if (highs_isInfinity(std::fabs(min_bound))) {
+        num_inf_min_activity_[row]++;
+      } else {
+        min_activity_[row] += value * min_bound;
+      }
+      if (highs_isInfinity(std::fabs(max_bound))) {
+        num_inf_max_activity_[row]++;
+      } else {
+        max_activity_[row] += value * max_bound;
+      }
+    }
+  }
+  row_queue_.clear();
+  row_in_queue_.assign(num_row, 0);
+  change_stack_.clear();
+  col_mark_.assign(num_col, 0);
+  conflict_start_.assign(1, 0);
+  conflict_literal_.clear();
+  conflict_watch_.clear();
+  col_conflict_.assign(num_col, std::vector<int>());
+  conflict_queue_.clear();
+  conflict_in_queue_.clear();
+}
+
+void HighsDomain::changeBound(const int col, const double lower,
+                              const double upper) {
+  if (lower == col_lower_[col] && upper == col_upper_[col]) return;
+  // Conflicts can only propagate when bounds are tightened
+  const bool tightened = lower > col_lower_[col] || upper < col_upper_[col];
+  setBound(col, lower, upper);
+  queuePropagation(col, tightened);
+}
+
+void HighsDomain::addConflict(const HighsConflictPool& pool,
+                              const int index) {
+  const int conflict = conflict_start_.size() - 1;
+  const HighsConflictLiteral* literal = pool.conflict(index);
+  const int conflict_size = pool.conflictSize(index);
+  const int start = conflict_literal_.size();
+  conflict_literal_.insert(conflict_literal_.end(), literal,
+                           literal + conflict_size);
+  conflict_start_.push_back(conflict_literal_.size());
+  // Watch the first two bounds, or the only bound twice. Propagation
+  // moves the watches to bounds that the domain doesn't satisfy.
+  conflict_watch_.push_back(start);
+  conflict_watch_.push_back(conflict_size > 1 ? start + 1 : start);
+  col_conflict_[literal[0].col].push_back(conflict);
+  if (conflict_size > 1 && literal[1].col != literal[0].col)
+    col_conflict_[literal[1].col].push_back(conflict);
+  conflict_in_queue_.push_back(1);
+  conflict_queue_.push_back(conflict);
+}
+
+bool HighsDomain::propagate() {
+  change_stack_.clear();
+  conflict_infeasible_ = false;
+  const int row_limit =
+      domain_propagation_row_limit_multiplier * mip_->numRow_ + 100;
+  int num_row_propagated = 0;
+  bool feasible = true;
+  int ix = 0;
+  int iy = 0;
+  // Propagating a conflict may queue rows, and vice versa
+  while (ix < (int)row_queue_.size() || iy < (int)conflict_queue_.size()) {
+    for (; ix < (int)row_queue_.size(); ix++) {
+      const int row = row_queue_[ix];
+      row_in_queue_[row] = 0;
+      if (!feasible || num_row_propagated >= row_limit) continue;
+      num_row_propagated++;
+      feasible = propagateRow(row);
+    }
+    for (; iy < (int)conflict_queue_.size(); iy++) {
+      const int conflict = conflict_queue_[iy];
+      conflict_in_queue_[conflict] = 0;
+      if (!feasible) continue;
+      feasible = propagateConflict(conflict);
+      if (!feasible) conflict_infeasible_ = true;
+    }
+  }
+  row_queue_.clear();
+  conflict_queue_.clear();
+  return feasible;
+}
+
+void HighsDomain::getPropagation(std::vector<int>& set,
+                                 std::vector<double>& lower,
+                                 std::vector<double>& upper) {
+  set.clear();
+  lower.clear();
+  upper.clear();
+  for (const BoundChange& change : change_stack_) {
+    if (col_mark_[change.col]) continue;
+    col_mark_[change.col] = 1;
+    set.push_back(change.col);
+    lower.push_back(col_lower_[change.col]);
+    upper.push_back(col_upper_[change.col]);
+  }
+  for (int col : set) col_mark_[col] = 0;
+}
+
+void HighsDomain::undoPropagation() {
+  while (!change_stack_.empty()) {
+    const BoundChange& change = change_stack_.back();
+    setBound(change.col, change.lower, change.upper);
+    change_stack_.pop_back();
+  }
+  for (int row : row_queue_) row_in_queue_[row] = 0;
+  row_queue_.clear();
+  for (int conflict : conflict_queue_) conflict_in_queue_[conflict] = 0;
+  conflict_queue_.clear();
+}
+
+void HighsDomain::setBound(const int col, const double lower,
+                           const double upper) {
+  const double old_lower = col_lower_[col];
+  const double old_upper = col_upper_[col];
+  col_lower_[col] = lower;
+  col_upper_[col] = upper;
+  for (int el = mip_->Astart_[col]; el < mip_->Astart_[col + 1]; el++) {
+    const int row = mip_->Aindex_[el];
+    const double value = mip_->Avalue_[el];
+    if (value > 0) {
+      if (lower != old_lower)
+        changeContribution(min_activity_[row], num_inf_min_activity_[row],
+                           value, old_lower, lower);
+      if (upper != old_upper)
+        changeContribution(max_activity_[row], num_inf_max_activity_[row],
+                           value, old_upper, upper);
+    } else {
+      if (upper != old_upper)
+        changeContribution(min_activity_[row], num_inf_min_activity_[row],
+                           value, old_upper, upper);
+      if (lower != old_lower)
+        changeContribution(max_activity_[row], num_inf_max_activity_[row],
+                           value, old_lower, lower);
+    }
+  }
+}
+
+void HighsDomain::queuePropagation(const int col, const bool tightened) {
+  for (int el = mip_->Astart_[col]; el < mip_->Astart_[col + 1]; el++) {
+    const int row = mip_->Aindex_[el];
+    if (row_in_queue_[row]) continue;
+    row_in_queue_[row] = 1;
+    row_queue_.push_back(row);
+  }
+  if (!tightened) return;
+  std::vector<int>& col_conflict = col_conflict_[col];
+  for (int ix = 0; ix < (int)col_conflict.size(); ix++) {
+    const int conflict = col_conflict[ix];
+    const int watch0 = conflict_watch_[2 * conflict];
+    const int watch1 = conflict_watch_[2 * conflict + 1];
+    if (conflict_literal_[watch0].col != col &&
+        conflict_literal_[watch1].col != col) {
+      // The conflict no longer watches this column
+      col_conflict[ix--] = col_conflict.back();
+      col_conflict.pop_back();
+      continue;
+    }
+    // Only a watched bound that is now satisfied can lead to
+    // propagation
+    const bool satisfied =
+        (conflict_literal_[watch0].col == col && literalStatus(watch0) > 0) ||
+        (conflict_literal_[watch1].col == col && literalStatus(watch1) > 0);
+    if (conflict_in_queue_[conflict] || !satisfied) continue;
+    conflict_in_queue_[conflict] = 1;
+    conflict_queue_.push_back(conflict);
+  }
+}
+
+bool HighsDomain::propagateRow(const int row) {
+  const double row_lower = mip_->rowLower_[row];
+  const double row_upper = mip_->rowUpper_[row];
+  const bool finite_upper = !highs_isInfinity(row_upper);
+  const bool finite_lower = !highs_isInfinity(-row_lower);
+  // Check whether the row activity bounds are consistent with the
+  // row bounds
+  if (finite_upper && num_inf_min_activity_[row] == 0 &&
+      min_activity_[row] > row_upper + feasibility_tolerance_ *
+                                           std::max(1.0, std::fabs(row_upper)))
+    return false;
+  if (finite_lower && num_inf_max_activity_[row] == 0 &&
+      max_activity_[row] < row_lower - feasibility_tolerance_ *
+                                           std::max(1.0, std::fabs(row_lower)))
+    return false;
+  // A column bound is only implied by a row bound if there's at most
+  // one infinite contribution to the corresponding activity bound
+  const bool use_upper = finite_upper && num_inf_min_activity_[row] <= 1;
+  const bool use_lower = finite_lower && num_inf_max_activity_[row] <= 1;
+  if (!use_upper && !use_lower) return true;
+  for (int el = ar_start_[row]; el < ar_start_[row + 1]; el++) {
+    const int col = ar_index_[el];
+    const double value = ar_value_[el];
+    double lower = col_lower_[col];
+    double upper = col_upper_[col];
+    if (use_upper) {
+      // The minimum activity of the rest of the row bounds this
+      // column's contribution from above
+      const double bound = value > 0 ? col_lower_[col] : col_upper_[col];
+      const bool infinite_bound = highs_isInfinity(std::fabs(bound));
+      if (num_inf_min_activity_[row] == (infinite_bound ? 1 : 0)) {
+        const double residual =
+            infinite_bound ? min_activity_[row]
+                           : min_activity_[row] - value * bound;
+        const double implied = (row_upper - residual) / value;
+        if (value > 0) {
+          upper = std::min(upper, implied);
+        } else {
+          lower = std::max(lower, implied);
+        }
+      }
+    }
+    if (use_lower) {
+      const double bound = value > 0 ? col_upper_[col] : col_lower_[col];
+      const bool infinite_bound = highs_isInfinity(std::fabs(bound));
+      if (num_inf_max_activity_[row] == (infinite_bound ? 1 : 0)) {
+        const double residual =
+            infinite_bound ? max_activity_[row]
+                           : max_activity_[row] - value * bound;
+        const double implied = (row_lower - residual) / value;
+        if (value > 0) {
+          lower = std::max(lower, implied);
+        } else {
+          upper = std::min(upper, implied);
+        }
+      }
+    }
+    if (!tightenBound(col, lower, upper)) return false;
+  }
+  return true;
+}
+
+int HighsDomain::literalStatus(const int el) const {
+  // Returns 1 if the domain satisfies the bound, -1 if it violates
+  // it, and 0 otherwise
+  const HighsConflictLiteral& literal = conflict_literal_[el];
+  const double lower = col_lower_[literal.col];
+  const double upper = col_upper_[literal.col];
+  if (literal.upper) {
+    if (upper <= literal.value) return 1;
+    if (lower > literal.value) return -1;
+  } else {
+    if (lower >= literal.value) return 1;
+    if (upper < literal.value) return -1;
+  }
+  return 0;
+}
+
+void HighsDomain::watchLiteral(const int conflict, const int el) {
+  const int col = conflict_literal_[el].col;
+  const int watch0 = conflict_watch_[2 * conflict];
+  const int watch1 = conflict_watch_[2 * conflict + 1];
+  if (conflict_literal_[watch0].col != col &&
+      conflict_literal_[watch1].col != col)
+    col_conflict_[col].push_back(conflict);
+}
+
+bool HighsDomain::propagateConflict(const int conflict) {
+  // A conflict is of no use if the domain violates one of its
+  // bounds. Otherwise, if the domain satisfies a watched bound, the
+  // watch moves to another bound that it doesn't satisfy. If there's
+  // none, then all bounds except the other watched bound are
+  // satisfied, so that bound must be violated.
+  int* watch = &conflict_watch_[2 * conflict];
+  const int start = conflict_start_[conflict];
+  const int end = conflict_start_[conflict + 1];
+  for (int k = 0; k < 2; k++) {
+    const int status = literalStatus(watch[k]);
+    if (status < 0) return true;
+    if (status == 0) continue;
+    for (int el = start; el < end; el++) {
+      if (el == watch[0] || el == watch[1]) continue;
+      const int el_status = literalStatus(el);
+      if (el_status > 0) continue;
+      watchLiteral(conflict, el);
+      watch[k] = el;
+      if (el_status < 0) return true;
+      break;
+    }
+  }
+  const int status0 = literalStatus(watch[0]);
+  const int status1 = literalStatus(watch[1]);
+  if (status0 > 0 && status1 > 0) return false;
+  if (status0 != 0 && status1 != 0) return true;
+  if (status0 == 0 && status1 == 0 && watch[0] != watch[1]) return true;
+  const HighsConflictLiteral& literal =
+      conflict_literal_[status0 == 0 ? watch[0] : watch[1]];
+  if (literal.upper)
+    return tightenBound(literal.col, literal.value + 1,
+                        col_upper_[literal.col]);
+  return tightenBound(literal.col, col_lower_[literal.col], literal.value - 1);
+}
+
+bool HighsDomain::tightenBound(const int col, double lower, double upper) {
+  const double old_lower = col_lower_[col];
+  const double old_upper = col_upper_[col];
+  bool change_lower;
+  bool change_upper;
+  if (mip_->integrality_[col]) {
+    lower = std::ceil(lower - feasibility_tolerance_);
+    upper = std::floor(upper + feasibility_tolerance_);
+    change_lower = lower > old_lower;
+    change_upper = upper < old_upper;
+  } else {
+    // Only accept a significant reduction in the width of the
+    // domain, relaxing the new bound by the feasibility tolerance
+    // to allow for rounding error in the activities
+    const double width = old_upper - old_lower;
+    const double min_reduction =
+        highs_isInfinity(width) ? 0 : domain_continuous_min_reduction * width;
+    lower -= feasibility_tolerance_ * std::max(1.0, std::fabs(lower));
+    upper += feasibility_tolerance_ * std::max(1.0, std::fabs(upper));
+    change_lower =
+        !highs_isInfinity(-lower) && lower > old_lower + min_reduction;
+    change_upper =
+        !highs_isInfinity(upper) && upper < old_upper - min_reduction;
+  }
+  if (!change_lower) lower = old_lower;
+  if (!change_upper) upper = old_upper;
+  if (!change_lower && !change_upper) return true;
+  if (lower > upper) {
+    if (lower >
+        upper + feasibility_tolerance_ * std::max(1.0, std::fabs(upper)))
+      return false;
+    // Within the tolerance, so fix the column
+    if (change_lower) {
+      lower = upper;
+    } else {
+      upper = lower;
+    }
+  }
+  change_stack_.push_back({col, old_lower, old_upper});
+  setBound(col, lower, upper);
+  queuePropagation(col, true);
+  return true;
+}
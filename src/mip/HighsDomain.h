@@ -0,0 +1,111 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef MIP_HIGHS_DOMAIN_H_
+#define MIP_HIGHS_DOMAIN_H_
+
+#include <vector>
+
+#include "lp_data/HighsLp.h"
+#include "mip/HighsConflictPool.h"
+
+// Column bounds of a MIP, together with the minimum and maximum
+// activity of each row that they imply. Activities are updated
+// incrementally when bounds change, and propagation derives the
+// bounds implied by the rows and conflicts containing columns whose
+// bounds have changed. The bound changes made by propagation can be
+// undone.
+class HighsDomain {
+ public:
+  void setup(const HighsLp& mip, const double feasibility_tolerance);
+
+  // Change the bounds on a column, queuing its rows and conflicts for
+  // propagation
+  void changeBound(const int col, const double lower, const double upper);
+
+  // Add a conflict from the pool, queuing it for propagation
+  void addConflict(const HighsConflictPool& pool, const int index);
+
+  // Propagate the queued rows and conflicts, returning false if the
+  // bounds are found to be infeasible
+  bool propagate();
+  // Whether the last call to propagate() found the bounds infeasible
+  // because they satisfy all the bounds in a conflict
+  bool conflictInfeasible() const { return conflict_infeasible_; }
+  // Get the columns whose bounds were changed by the last call to
+  // propagate(), together with their new bounds
+  void getPropagation(std::vector<int>& set, std::vector<double>& lower,
+                      std::vector<double>& upper);
+  // Restore the bounds changed by the last call to propagate()
+  void undoPropagation();
+
+  const std::vector<double>& colLower() const { return col_lower_; }
+  const std::vector<double>& colUpper() const { return col_upper_; }
+
+ private:
+  void setBound(const int col, const double lower, const double upper);
+  void queuePropagation(const int col, const bool tightened);
+  bool propagateRow(const int row);
+  bool propagateConflict(const int conflict);
+  int literalStatus(const int el) const;
+  void watchLiteral(const int conflict, const int el);
+  bool tightenBound(const int col, double lower, double upper);
+
+  const HighsLp* mip_ = nullptr;
+  double feasibility_tolerance_ = 0;
+
+  // Row-wise copy of the constraint matrix
+  std::vector<int> ar_start_;
+  std::vector<int> ar_index_;
+  std::vector<double> ar_value_;
+
+  std::vector<double> col_lower_;
+  std::vector<double> col_upper_;
+  // Sums of the finite contributions to the minimum and maximum row
+  // activities, and the number of infinite contributions
+  std::vector<double> min_activity_;
+  std::vector<double> max_activity_;
+  std::vector<int> num_inf_min_activity_;
+  std::vector<int> num_inf_max_activity_;
+
+  std::vector<int> row_queue_;
+  std::vector<int> row_in_queue_;
+
+  // Conflicts added to the domain. Each conflict watches two of its
+  // bounds that the domain doesn't satisfy, if it can, and is only
+  // propagated when the bounds on their columns change. The lists of
+  // conflicts watching each column may contain conflicts that have
+  // stopped watching it, which are removed when the list is next
+  // used.
+  std::vector<int> conflict_start_;
+  std::vector<HighsConflictLiteral> conflict_literal_;
+  std::vector<int> conflict_watch_;
+  std::vector<std::vector<int>> col_conflict_;
+  std::vector<int> conflict_queue_;
+  std::vector<int> conflict_in_queue_;
+  bool conflict_infeasible_ = false;
+
+  // Bounds before each change made by propagation
+  struct BoundChange {
+    int col;
+    double lower;
+    double upper;
+  };
+  std::vector<BoundChange> change_stack_;
+  std::vector<int> col_mark_;
+};
+
+// The number of row propagations in one call to propagate() is
+// limited to a multiple of the number of rows
+const int domain_propagation_row_limit_multiplier = 4;
+// Bounds on continuous columns are only tightened if the width of
+// their domain is reduced by at least this fraction
+const double domain_continuous_min_reduction = 0.05;
+
+#endif
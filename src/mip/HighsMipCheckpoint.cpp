@@ -0,0 +1,196 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsMipCheckpoint.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+// Identifies a checkpoint file and the version of its format
+const char kCheckpointMagic[8] = {'H', 'i', 'G', 'H', 'S', 'C', 'P', '1'};
+
+template <typename T>
+static void writeValue(std::ostream& out, const T& value) {
+  out.write((const char*)&value, sizeof(T));
+}
+
+template <typename T>
+static void writeVector(std::ostream& out, const std::vector<T>& vector) {
+  const int size = vector.size();
+  writeValue(out, size);
+  if (size) out.write((const char*)&vector[0], size * sizeof(T));
+}
+
+template <typename T>
+static bool readValue(std::istream& in, T& value) {
+  in.read((char*)&value, sizeof(T));
+  return (bool)in;
+}
+
+template <typename T>
+static bool readVector(std::istream& in, std::vector<T>& vector) {
+  int size;
+  if (!readValue(in, size) || size < 0) return false;
+  vector.resize(size);
+  if (size) in.read((char*)&vector[0], size * sizeof(T));
+  return (bool)in;
+}
+
+bool HighsMipCheckpoint::write(const std::string& filename) const {
+  const std::string temporary_filename = filename + ".tmp";
+  std::ofstream out(temporary_filename, std::ios::binary | std::ios::trunc);
+  if (!out) return false;
+  out.write(kCheckpointMagic, sizeof(kCheckpointMagic));
+  writeValue(out, mip_hash);
+  writeVector(out, root_col_lower);
+  writeVector(out, root_col_upper);
+  writeValue(out, best_objective);
+  writeVector(out, best_solution);
+
+  writeVector(out, pseudocost.sum_down);
+  writeVector(out, pseudocost.sum_up);
+  writeVector(out, pseudocost.num_down);
+  writeVector(out, pseudocost.num_up);
+  for (int up = 0; up < 2; up++) {
+    writeValue(out, pseudocost.sum_all[up]);
+    writeValue(out, pseudocost.num_all[up]);
+  }
+
+  writeValue(out, lp_num_row);
+  writeValue(out, (int)basis.size());
+  for (const HighsPackedBasis& node_basis : basis) {
+    writeValue(out, node_basis.num_col);
+    writeValue(out, node_basis.num_row);
+    writeVector(out, node_basis.packed_status);
+    writeVector(out, node_basis.other_status);
+  }
+
+  writeValue(out, (int)node.size());
+  for (const HighsCheckpointNode& open_node : node) {
+    writeValue(out, open_node.parent_objective);
+    writeValue(out, open_node.estimate);
+    writeValue(out, open_node.branch_col);
+    writeValue(out, open_node.branch_col_lower);
+    writeValue(out, open_node.branch_col_upper);
+    writeValue(out, open_node.branch_fraction);
+    writeValue(out, open_node.branch_up);
+    writeValue(out, open_node.basis);
+    writeVector(out, open_node.col);
+    writeVector(out, open_node.col_lower);
+    writeVector(out, open_node.col_upper);
+  }
+
+  writeValue(out, num_nodes_formed);
+  writeValue(out, num_nodes_solved);
+  writeValue(out, num_nodes_pruned);
+  writeValue(out, num_integer_solutions);
+  writeValue(out, total_simplex_iterations);
+  out.close();
+  if (!out) {
+    std::remove(temporary_filename.c_str());
+    return false;
+  }
+  return std::rename(temporary_filename.c_str(), filename.c_str()) == 0;
+}
+
+bool HighsMipCheckpoint::read(const std::string& filename) {
+  std::ifstream in(filename, std::ios::binary);
+  if (!in) return false;
+  char magic[sizeof(kCheckpointMagic)];
+  in.read(magic, sizeof(magic));
+  if (!in || std::memcmp(magic, kCheckpointMagic, sizeof(magic)) != 0)
+    return false;
+  if (!readValue(in, mip_hash) || !readVector(in, root_col_lower) ||
+      !readVector(in, root_col_upper) || !readValue(in, best_objective) ||
+      !readVector(in, best_solution))
+    return false;
+
+  if (!readVector(in, pseudocost.sum_down) ||
+      !readVector(in, pseudocost.sum_up) ||
+      !readVector(in, pseudocost.num_down) ||
+      !readVector(in, pseudocost.num_up))
+    return false;
+  const size_t pseudocost_num_col = pseudocost.sum_down.size();
+  if (pseudocost.sum_up.size() != pseudocost_num_col ||
+      pseudocost.num_down.size() != pseudocost_num_col ||
+      pseudocost.num_up.size() != pseudocost_num_col)
+    return false;
+  for (int up = 0; up < 2; up++)
+    if (!readValue(in, pseudocost.sum_all[up]) ||
+        !readValue(in, pseudocost.num_all[up]))
+      return false;
+
+  int num_basis;
+  if (!readValue(in, lp_num_row) || !readValue(in, num_basis) ||
+      num_basis < 0)
+    return false;
+  basis.resize(num_basis);
+  for (HighsPackedBasis& node_basis : basis)
+    if (!readValue(in, node_basis.num_col) ||
+        !readValue(in, node_basis.num_row) ||
+        !readVector(in, node_basis.packed_status) ||
+        !readVector(in, node_basis.other_status))
+      return false;
+
+  int num_node;
+  if (!readValue(in, num_node) || num_node < 0) return false;
+  node.resize(num_node);
+  for (HighsCheckpointNode& open_node : node) {
+    if (!readValue(in, open_node.parent_objective) ||
+        !readValue(in, open_node.estimate) ||
+        !readValue(in, open_node.branch_col) ||
+        !readValue(in, open_node.branch_col_lower) ||
+        !readValue(in, open_node.branch_col_upper) ||
+        !readValue(in, open_node.branch_fraction) ||
+        !readValue(in, open_node.branch_up) ||
+        !readValue(in, open_node.basis) || !readVector(in, open_node.col) ||
+        !readVector(in, open_node.col_lower) ||
+        !readVector(in, open_node.col_upper))
+      return false;
+    if (open_node.basis >= num_basis ||
+        open_node.col_lower.size() != open_node.col.size() ||
+        open_node.col_upper.size() != open_node.col.size())
+      return false;
+  }
+
+  return readValue(in, num_nodes_formed) && readValue(in, num_nodes_solved) &&
+         readValue(in, num_nodes_pruned) &&
+         readValue(in, num_integer_solutions) &&
+         readValue(in, total_simplex_iterations);
+}
+
+uint64_t HighsMipCheckpoint::hashMip(const HighsLp& mip) {
+  // FNV-1a hash of the dimensions and data of the MIP
+  uint64_t hash = 0xcbf29ce484222325ull;
+  auto add = [&](const void* data, const size_t num_byte) {
+    const unsigned char* byte = (const unsigned char*)data;
+    for (size_t ix = 0; ix < num_byte; ix++)
+      hash = (hash ^ byte[ix]) * 0x100000001b3ull;
+  };
+  auto addDouble = [&](const std::vector<double>& vector) {
+    if (!vector.empty()) add(&vector[0], vector.size() * sizeof(double));
+  };
+  auto addInt = [&](const std::vector<int>& vector) {
+    if (!vector.empty()) add(&vector[0], vector.size() * sizeof(int));
+  };
+  add(&mip.numCol_, sizeof(mip.numCol_));
+  add(&mip.numRow_, sizeof(mip.numRow_));
+  add(&mip.offset_, sizeof(mip.offset_));
+  addDouble(mip.colCost_);
+  addDouble(mip.colLower_);
+  addDouble(mip.colUpper_);
+  addDouble(mip.rowLower_);
+  addDouble(mip.rowUpper_);
+  addInt(mip.Astart_);
+  addInt(mip.Aindex_);
+  addDouble(mip.Avalue_);
+  addInt(mip.integrality_);
+  return hash;
+}
@@ -0,0 +1,68 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef MIP_HIGHS_MIP_CHECKPOINT_H_
+#define MIP_HIGHS_MIP_CHECKPOINT_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "lp_data/HighsLp.h"
+#include "mip/HighsPackedBasis.h"
+#include "mip/HighsPseudocost.h"
+
+// An open node of the MIP tree: its bounds on the columns whose
+// bounds differ from those at the root, how it was branched on, and
+// the index of its parent's basis in the checkpoint, or -1 if there
+// is none
+struct HighsCheckpointNode {
+  double parent_objective;
+  double estimate;
+  int branch_col;
+  double branch_col_lower;
+  double branch_col_upper;
+  double branch_fraction;
+  bool branch_up;
+  int basis;
+  std::vector<int> col;
+  std::vector<double> col_lower;
+  std::vector<double> col_upper;
+};
+
+// The state of a MIP search from which it can be resumed: the open
+// nodes, the incumbent, the pseudocosts and the search statistics. It
+// is written in a binary format that is only meant to be read by the
+// same build, and is tied to the MIP by a hash of its data.
+struct HighsMipCheckpoint {
+  uint64_t mip_hash = 0;
+  std::vector<double> root_col_lower;
+  std::vector<double> root_col_upper;
+  double best_objective = 0;
+  std::vector<double> best_solution;
+  HighsPseudocost pseudocost;
+  // The bases are only used if the LP relaxation has lp_num_row rows
+  int lp_num_row = 0;
+  std::vector<HighsPackedBasis> basis;
+  std::vector<HighsCheckpointNode> node;
+  int num_nodes_formed = 0;
+  int num_nodes_solved = 0;
+  int num_nodes_pruned = 0;
+  int num_integer_solutions = 0;
+  int total_simplex_iterations = 0;
+
+  // The checkpoint is written to a temporary file that then replaces
+  // the file, so an interrupted write leaves any previous checkpoint
+  bool write(const std::string& filename) const;
+  bool read(const std::string& filename);
+
+  static uint64_t hashMip(const HighsLp& mip);
+};
+
+#endif
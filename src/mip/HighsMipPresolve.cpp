@@ -0,0 +1,582 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsMipPresolve.h"
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <string>
+
+#include "lp_data/HighsLpUtils.h"
+#include "util/HighsUtils.h"
+
+HighsMipPresolveStatus HighsMipPresolve::presolve(
+    HighsLp& mip, const double feasibility_tolerance) {
+  feasibility_tolerance_ = feasibility_tolerance;
+  num_col_ = mip.numCol_;
+  num_row_ = mip.numRow_;
+  original_num_col_ = num_col_;
+  info_ = HighsMipPresolveInfo();
+  col_map_.resize(num_col_);
+  for (int iCol = 0; iCol < num_col_; iCol++) col_map_[iCol] = iCol;
+  removed_col_value_.assign(num_col_, 0);
+  if (num_col_ == 0) return HighsMipPresolveStatus::kNotReduced;
+
+  const double sense = (double)mip.sense_;
+  col_cost_.resize(num_col_);
+  for (int iCol = 0; iCol < num_col_; iCol++)
+    col_cost_[iCol] = sense * mip.colCost_[iCol];
+  col_lower_ = mip.colLower_;
+  col_upper_ = mip.colUpper_;
+  integrality_ = mip.integrality_;
+  integrality_.resize(num_col_, 0);
+  row_lower_ = mip.rowLower_;
+  row_upper_ = mip.rowUpper_;
+  getRowwiseMatrix(mip, ar_start_, ar_index_, ar_value_);
+  row_removed_.assign(num_row_, 0);
+  min_activity_.assign(num_row_, 0);
+  max_activity_.assign(num_row_, 0);
+  num_inf_min_activity_.assign(num_row_, 0);
+  num_inf_max_activity_.assign(num_row_, 0);
+  clique_start_.assign(1, 0);
+  clique_index_.clear();
+
+  if (!roundBounds()) return HighsMipPresolveStatus::kInfeasible;
+  for (int pass = 0; pass < mip_presolve_max_passes; pass++) {
+    changed_ = false;
+    for (int iRow = 0; iRow < num_row_; iRow++) {
+      if (row_removed_[iRow]) continue;
+      if (!reduceRow(iRow)) return HighsMipPresolveStatus::kInfeasible;
+      if (row_removed_[iRow]) continue;
+      if (!tightenIntegerBounds(iRow))
+        return HighsMipPresolveStatus::kInfeasible;
+      tightenCoefficients(iRow);
+    }
+    fixDualColumns();
+    if (!changed_) break;
+  }
+  detectImpliedIntegers();
+  extractCliques();
+
+  bool fixed_col = false;
+  for (int iCol = 0; iCol < num_col_; iCol++)
+    if (col_lower_[iCol] == col_upper_[iCol]) fixed_col = true;
+  bool removed_row = false;
+  for (int iRow = 0; iRow < num_row_; iRow++)
+    if (row_removed_[iRow]) removed_row = true;
+  if (!fixed_col && !removed_row && !info_.num_tightened_bound &&
+      !info_.num_tightened_coefficient && !info_.num_implied_integer &&
+      !info_.num_clique_row)
+    return HighsMipPresolveStatus::kNotReduced;
+  formReducedMip(mip);
+  return HighsMipPresolveStatus::kReduced;
+}
+
+void HighsMipPresolve::postsolve(const std::vector<double>& reduced_solution,
+                                 std::vector<double>& solution) const {
+  solution = removed_col_value_;
+  for (int iCol = 0; iCol < (int)col_map_.size(); iCol++)
+    solution[col_map_[iCol]] = reduced_solution[iCol];
+}
+
+bool HighsMipPresolve::roundBounds() {
+  for (int iCol = 0; iCol < num_col_; iCol++) {
+    if (col_lower_[iCol] > col_upper_[iCol] + feasibility_tolerance_)
+      return false;
+    if (!integrality_[iCol]) continue;
+    if (!changeBound(iCol, col_lower_[iCol], col_upper_[iCol])) return false;
+  }
+  return true;
+}
+
+bool HighsMipPresolve::changeBound(const int col, double lower,
+                                   double upper) {
+  if (integrality_[col]) {
+    lower = std::ceil(lower - feasibility_tolerance_);
+    upper = std::floor(upper + feasibility_tolerance_);
+  }
+  bool lower_changed = false;
+  bool upper_changed = false;
+  if (lower > -HIGHS_CONST_INF && lower - col_lower_[col] >
+      mip_presolve_min_change * std::max(1.0, std::fabs(lower)))
+    lower_changed = true;
+  else
+    lower = col_lower_[col];
+  if (upper < HIGHS_CONST_INF && col_upper_[col] - upper >
+      mip_presolve_min_change * std::max(1.0, std::fabs(upper)))
+    upper_changed = true;
+  else
+    upper = col_upper_[col];
+  if (!lower_changed && !upper_changed) return true;
+  if (lower > upper) {
+    if (lower > upper + feasibility_tolerance_) return false;
+    // Only continuous columns can get here, and are fixed at the
+    // bound that has been kept
+    if (lower_changed && upper_changed)
+      lower = upper = 0.5 * (lower + upper);
+    else if (lower_changed)
+      lower = upper;
+    else
+      upper = lower;
+  }
+  col_lower_[col] = lower;
+  col_upper_[col] = upper;
+  info_.num_tightened_bound += lower_changed + upper_changed;
+  changed_ = true;
+  return true;
+}
+
+void HighsMipPresolve::computeRowActivity(const int row) {
+  double min_activity = 0;
+  double max_activity = 0;
+  int num_inf_min_activity = 0;
+  int num_inf_max_activity = 0;
+  for (int iEl = ar_start_[row]; iEl < ar_start_[row + 1]; iEl++) {
+    const int iCol = ar_index_[iEl];
+    const double value = ar_value_[iEl];
+    const double min_bound = value > 0 ? col_lower_[iCol] : col_upper_[iCol];
+    const double max_bound = value > 0 ? col_upper_[iCol] : col_lower_[iCol];
+    if (highs_isInfinity(std::fabs(min_bound)))
+      num_inf_min_activity++;
+    else
+      min_activity += value * min_bound;
+    if (highs_isInfinity(std::fabs(max_bound)))
+      num_inf_max_activity++;
+    else
+      max_activity += value * max_bound;
+  }
+  min_activity_[row] = min_activity;
+  max_activity_[row] = max_activity;
+  num_inf_min_activity_[row] = num_inf_min_activity;
+  num_inf_max_activity_[row] = num_inf_max_activity;
+}
+
+bool HighsMipPresolve::reduceRow(const int row) {
+  computeRowActivity(row);
+  const double lower = row_lower_[row];
+  const double upper = row_upper_[row];
+  const bool min_finite = num_inf_min_activity_[row] == 0;
+  const bool max_finite = num_inf_max_activity_[row] == 0;
+  if (min_finite && min_activity_[row] > upper + feasibility_tolerance_)
+    return false;
+  if (max_finite && max_activity_[row] < lower - feasibility_tolerance_)
+    return false;
+
+  // The row is redundant if it's satisfied by all values in the
+  // column bounds
+  const bool lower_redundant =
+      highs_isInfinity(-lower) ||
+      (min_finite && min_activity_[row] >=
+                         lower - mip_presolve_min_change *
+                                     std::max(1.0, std::fabs(lower)));
+  const bool upper_redundant =
+      highs_isInfinity(upper) ||
+      (max_finite && max_activity_[row] <=
+                         upper + mip_presolve_min_change *
+                                     std::max(1.0, std::fabs(upper)));
+  if (lower_redundant && upper_redundant) {
+    row_removed_[row] = 1;
+    changed_ = true;
+    return true;
+  }
+
+  // A row with only one column that isn't fixed is replaced by bounds
+  // on that column
+  int singleton_el = -1;
+  double fixed_activity = 0;
+  for (int iEl = ar_start_[row]; iEl < ar_start_[row + 1]; iEl++) {
+    const int iCol = ar_index_[iEl];
+    if (col_lower_[iCol] == col_upper_[iCol]) {
+      fixed_activity += ar_value_[iEl] * col_lower_[iCol];
+    } else if (singleton_el < 0) {
+      singleton_el = iEl;
+    } else {
+      return true;
+    }
+  }
+  // All columns are fixed, and the row is satisfied to within the
+  // feasibility tolerance
+  if (singleton_el < 0) {
+    row_removed_[row] = 1;
+    changed_ = true;
+    return true;
+  }
+  const int iCol = ar_index_[singleton_el];
+  const double value = ar_value_[singleton_el];
+  double col_lower = (lower - fixed_activity) / value;
+  double col_upper = (upper - fixed_activity) / value;
+  if (value < 0) std::swap(col_lower, col_upper);
+  if (!changeBound(iCol, col_lower, col_upper)) return false;
+  row_removed_[row] = 1;
+  changed_ = true;
+  return true;
+}
+
+bool HighsMipPresolve::tightenIntegerBounds(const int row) {
+  const double lower = row_lower_[row];
+  const double upper = row_upper_[row];
+  for (int iEl = ar_start_[row]; iEl < ar_start_[row + 1]; iEl++) {
+    const int iCol = ar_index_[iEl];
+    if (!integrality_[iCol] || col_lower_[iCol] == col_upper_[iCol]) continue;
+    const double value = ar_value_[iEl];
+    // The contributions of the column to the activity bounds, which
+    // are those when the activities were computed
+    const double min_bound = value > 0 ? col_lower_[iCol] : col_upper_[iCol];
+    const double max_bound = value > 0 ? col_upper_[iCol] : col_lower_[iCol];
+    const bool min_bound_inf = highs_isInfinity(std::fabs(min_bound));
+    const bool max_bound_inf = highs_isInfinity(std::fabs(max_bound));
+    double col_lower = -HIGHS_CONST_INF;
+    double col_upper = HIGHS_CONST_INF;
+    // Use the bounds on the activity of the other columns
+    if (!highs_isInfinity(upper) &&
+        num_inf_min_activity_[row] == (int)min_bound_inf) {
+      const double residual_min_activity =
+          min_activity_[row] - (min_bound_inf ? 0 : value * min_bound);
+      const double bound = (upper - residual_min_activity) / value;
+      if (value > 0)
+        col_upper = bound;
+      else
+        col_lower = bound;
+    }
+    if (!highs_isInfinity(-lower) &&
+        num_inf_max_activity_[row] == (int)max_bound_inf) {
+      const double residual_max_activity =
+          max_activity_[row] - (max_bound_inf ? 0 : value * max_bound);
+      const double bound = (lower - residual_max_activity) / value;
+      if (value > 0)
+        col_lower = bound;
+      else
+        col_upper = bound;
+    }
+    if (std::fabs(col_lower) > mip_presolve_max_implied_bound)
+      col_lower = -HIGHS_CONST_INF;
+    if (std::fabs(col_upper) > mip_presolve_max_implied_bound)
+      col_upper = HIGHS_CONST_INF;
+    if (!changeBound(iCol, col_lower, col_upper)) return false;
+  }
+  return true;
+}
+
+void HighsMipPresolve::tightenCoefficients(const int row) {
+  // Only rows with one finite bound, written as sum_j a_j x_j <= b
+  // by negating rows with a lower bound
+  const bool has_lower = !highs_isInfinity(-row_lower_[row]);
+  const bool has_upper = !highs_isInfinity(row_upper_[row]);
+  if (has_lower == has_upper) return;
+  computeRowActivity(row);
+  const double sign = has_upper ? 1 : -1;
+  if (has_upper ? num_inf_max_activity_[row] : num_inf_min_activity_[row])
+    return;
+  double max_activity = sign * (has_upper ? max_activity_[row]
+                                          : min_activity_[row]);
+  double rhs = sign * (has_upper ? row_upper_[row] : row_lower_[row]);
+  // For a binary column with a_j > 0, if the row is redundant when
+  // x_j = 0, then reducing a_j and b by d = b - (M - a_j) gives the
+  // same integer solutions and a tighter relaxation. Similarly, for
+  // a_j < 0, if the row is redundant when x_j = 1, then a_j can be
+  // increased by d = b - (M + a_j)
+  for (int iEl = ar_start_[row]; iEl < ar_start_[row + 1]; iEl++) {
+    if (max_activity <= rhs) break;
+    const int iCol = ar_index_[iEl];
+    if (!integrality_[iCol] || col_lower_[iCol] != 0 || col_upper_[iCol] != 1)
+      continue;
+    const double value = sign * ar_value_[iEl];
+    if (value > 0) {
+      const double d = rhs - (max_activity - value);
+      if (d <= mip_presolve_min_change * std::max(1.0, std::fabs(value)))
+        continue;
+      ar_value_[iEl] = sign * (value - d);
+      rhs -= d;
+      max_activity -= d;
+    } else {
+      const double d = rhs - (max_activity + value);
+      if (d <= mip_presolve_min_change * std::max(1.0, std::fabs(value)))
+        continue;
+      ar_value_[iEl] = sign * (value + d);
+    }
+    info_.num_tightened_coefficient++;
+    changed_ = true;
+  }
+  if (has_upper)
+    row_upper_[row] = rhs;
+  else
+    row_lower_[row] = -rhs;
+}
+
+void HighsMipPresolve::fixDualColumns() {
+  // Count the rows that may become infeasible if each column is
+  // decreased or increased
+  std::vector<int> down_locks(num_col_, 0);
+  std::vector<int> up_locks(num_col_, 0);
+  for (int iRow = 0; iRow < num_row_; iRow++) {
+    if (row_removed_[iRow]) continue;
+    const bool has_lower = !highs_isInfinity(-row_lower_[iRow]);
+    const bool has_upper = !highs_isInfinity(row_upper_[iRow]);
+    for (int iEl = ar_start_[iRow]; iEl < ar_start_[iRow + 1]; iEl++) {
+      const int iCol = ar_index_[iEl];
+      if (ar_value_[iEl] > 0) {
+        down_locks[iCol] += has_lower;
+        up_locks[iCol] += has_upper;
+      } else {
+        down_locks[iCol] += has_upper;
+        up_locks[iCol] += has_lower;
+      }
+    }
+  }
+  // A column whose cost is not increased by moving to one of its
+  // bounds, and which can't make any row infeasible by doing so, can
+  // be fixed at that bound
+  for (int iCol = 0; iCol < num_col_; iCol++) {
+    if (col_lower_[iCol] == col_upper_[iCol]) continue;
+    const double cost = col_cost_[iCol];
+    if (cost >= 0 && !down_locks[iCol] &&
+        !highs_isInfinity(-col_lower_[iCol])) {
+      col_upper_[iCol] = col_lower_[iCol];
+    } else if (cost <= 0 && !up_locks[iCol] &&
+               !highs_isInfinity(col_upper_[iCol])) {
+      col_lower_[iCol] = col_upper_[iCol];
+    } else {
+      continue;
+    }
+    info_.num_dual_fixed++;
+    changed_ = true;
+  }
+}
+
+void HighsMipPresolve::detectImpliedIntegers() {
+  // In an equality row sum_j a_j x_j = b where x_k is the only
+  // continuous column that's not fixed, x_k is integer if a_j / a_k
+  // is integer for the other columns that aren't fixed, and (b -
+  // sum_{fixed j} a_j x_j) / a_k is integer
+  auto isIntegral = [&](const double x) {
+    return std::fabs(x - std::round(x)) <= feasibility_tolerance_;
+  };
+  for (int iRow = 0; iRow < num_row_; iRow++) {
+    if (row_removed_[iRow] || row_lower_[iRow] != row_upper_[iRow]) continue;
+    int continuous_el = -1;
+    double rhs = row_upper_[iRow];
+    bool implied_integer = true;
+    for (int iEl = ar_start_[iRow]; iEl < ar_start_[iRow + 1]; iEl++) {
+      const int iCol = ar_index_[iEl];
+      if (col_lower_[iCol] == col_upper_[iCol]) {
+        rhs -= ar_value_[iEl] * col_lower_[iCol];
+      } else if (!integrality_[iCol]) {
+        if (continuous_el >= 0) {
+          implied_integer = false;
+          break;
+        }
+        continuous_el = iEl;
+      }
+    }
+    if (!implied_integer || continuous_el < 0) continue;
+    const double value = ar_value_[continuous_el];
+    if (!isIntegral(rhs / value)) continue;
+    for (int iEl = ar_start_[iRow]; iEl < ar_start_[iRow + 1]; iEl++) {
+      const int iCol = ar_index_[iEl];
+      if (iEl == continuous_el || col_lower_[iCol] == col_upper_[iCol])
+        continue;
+      if (!isIntegral(ar_value_[iEl] / value)) {
+        implied_integer = false;
+        break;
+      }
+    }
+    if (!implied_integer) continue;
+    const int iCol = ar_index_[continuous_el];
+    if (std::ceil(col_lower_[iCol] - feasibility_tolerance_) >
+        std::floor(col_upper_[iCol] + feasibility_tolerance_))
+      continue;
+    integrality_[iCol] = 1;
+    info_.num_implied_integer++;
+    changeBound(iCol, col_lower_[iCol], col_upper_[iCol]);
+  }
+}
+
+void HighsMipPresolve::extractCliques() {
+  // Writing a row as sum_j a_j x_j <= b, where the a_j of binary
+  // columns are sorted in decreasing order, no two of the first k+1
+  // such columns can be one if a_{k-1} + a_k exceeds b less the
+  // minimum activity of the other columns
+  std::set<std::vector<int>> cliques;
+  std::vector<std::pair<double, int>> binary;
+  for (int iRow = 0; iRow < num_row_; iRow++) {
+    if (row_removed_[iRow]) continue;
+    computeRowActivity(iRow);
+    for (int side = 0; side < 2; side++) {
+      const double sign = side == 0 ? 1 : -1;
+      const double bound = side == 0 ? row_upper_[iRow] : -row_lower_[iRow];
+      if (highs_isInfinity(bound)) continue;
+      if (side == 0 ? num_inf_min_activity_[iRow]
+                    : num_inf_max_activity_[iRow])
+        continue;
+      double rhs = bound - sign * (side == 0 ? min_activity_[iRow]
+                                             : max_activity_[iRow]);
+      binary.clear();
+      for (int iEl = ar_start_[iRow]; iEl < ar_start_[iRow + 1]; iEl++) {
+        const int iCol = ar_index_[iEl];
+        const double value = sign * ar_value_[iEl];
+        if (value > 0 && integrality_[iCol] && col_lower_[iCol] == 0 &&
+            col_upper_[iCol] == 1)
+          binary.push_back(std::make_pair(value, iCol));
+      }
+      if (binary.size() < 3) continue;
+      std::sort(binary.begin(), binary.end(),
+                [](const std::pair<double, int>& a,
+                   const std::pair<double, int>& b) {
+                  return a.first > b.first;
+                });
+      int clique_size = 0;
+      for (int k = 1; k < (int)binary.size(); k++) {
+        if (binary[k - 1].first + binary[k].first <=
+            rhs + feasibility_tolerance_)
+          break;
+        clique_size = k + 1;
+      }
+      if (clique_size < 3) continue;
+      // A row of equal coefficients over the clique columns is
+      // already a clique
+      const int row_length = ar_start_[iRow + 1] - ar_start_[iRow];
+      if (clique_size == row_length &&
+          binary[0].first == binary[clique_size - 1].first)
+        continue;
+      std::vector<int> clique(clique_size);
+      for (int k = 0; k < clique_size; k++) clique[k] = binary[k].second;
+      std::sort(clique.begin(), clique.end());
+      if (!cliques.insert(clique).second) continue;
+      clique_index_.insert(clique_index_.end(), clique.begin(), clique.end());
+      clique_start_.push_back(clique_index_.size());
+      info_.num_clique_row++;
+    }
+  }
+}
+
+void HighsMipPresolve::formReducedMip(HighsLp& mip) {
+  // Remove the fixed columns, keeping one if they're all fixed
+  std::vector<int> new_col_index(num_col_, -1);
+  int new_num_col = 0;
+  for (int iCol = 0; iCol < num_col_; iCol++) {
+    if (col_lower_[iCol] == col_upper_[iCol]) continue;
+    new_col_index[iCol] = new_num_col++;
+  }
+  if (new_num_col == 0) new_col_index[0] = new_num_col++;
+  col_map_.resize(new_num_col);
+  for (int iCol = 0; iCol < num_col_; iCol++) {
+    if (new_col_index[iCol] >= 0) {
+      col_map_[new_col_index[iCol]] = iCol;
+    } else {
+      removed_col_value_[iCol] = col_lower_[iCol];
+      mip.offset_ += mip.colCost_[iCol] * col_lower_[iCol];
+    }
+  }
+
+  // Remove the removed rows, keeping one if they're all removed, and
+  // add the clique rows
+  std::vector<int> new_row_index(num_row_, -1);
+  int new_num_row = 0;
+  for (int iRow = 0; iRow < num_row_; iRow++) {
+    if (row_removed_[iRow]) continue;
+    new_row_index[iRow] = new_num_row++;
+  }
+  const int num_clique = clique_start_.size() - 1;
+  if (new_num_row + num_clique == 0 && num_row_ > 0)
+    new_row_index[0] = new_num_row++;
+
+  std::vector<double> row_lower;
+  std::vector<double> row_upper;
+  std::vector<int> ar_start;
+  std::vector<int> ar_index;
+  std::vector<double> ar_value;
+  std::vector<std::string> row_names;
+  const bool have_row_names = (int)mip.row_names_.size() == num_row_;
+  ar_start.push_back(0);
+  for (int iRow = 0; iRow < num_row_; iRow++) {
+    if (new_row_index[iRow] < 0) continue;
+    double fixed_activity = 0;
+    for (int iEl = ar_start_[iRow]; iEl < ar_start_[iRow + 1]; iEl++) {
+      const int iCol = ar_index_[iEl];
+      if (new_col_index[iCol] < 0) {
+        fixed_activity += ar_value_[iEl] * col_lower_[iCol];
+      } else {
+        ar_index.push_back(new_col_index[iCol]);
+        ar_value.push_back(ar_value_[iEl]);
+      }
+    }
+    ar_start.push_back(ar_index.size());
+    if (row_removed_[iRow]) {
+      // A row that's been removed but is kept is made free
+      row_lower.push_back(-HIGHS_CONST_INF);
+      row_upper.push_back(HIGHS_CONST_INF);
+    } else {
+      row_lower.push_back(row_lower_[iRow] - fixed_activity);
+      row_upper.push_back(row_upper_[iRow] - fixed_activity);
+    }
+    if (have_row_names) row_names.push_back(mip.row_names_[iRow]);
+  }
+  for (int iClique = 0; iClique < num_clique; iClique++) {
+    for (int iEl = clique_start_[iClique]; iEl < clique_start_[iClique + 1];
+         iEl++) {
+      ar_index.push_back(new_col_index[clique_index_[iEl]]);
+      ar_value.push_back(1);
+    }
+    ar_start.push_back(ar_index.size());
+    row_lower.push_back(-HIGHS_CONST_INF);
+    row_upper.push_back(1);
+    if (have_row_names)
+      row_names.push_back("clique_" + std::to_string(iClique));
+  }
+  new_num_row += num_clique;
+  info_.num_removed_row = num_row_ + num_clique - new_num_row;
+  info_.num_removed_col = num_col_ - new_num_col;
+
+  // Form the column-wise matrix of the reduced MIP
+  std::vector<int> a_start(new_num_col + 1, 0);
+  for (int iEl = 0; iEl < (int)ar_index.size(); iEl++)
+    a_start[ar_index[iEl] + 1]++;
+  for (int iCol = 0; iCol < new_num_col; iCol++)
+    a_start[iCol + 1] += a_start[iCol];
+  std::vector<int> a_index(ar_index.size());
+  std::vector<double> a_value(ar_index.size());
+  std::vector<int> a_next = a_start;
+  for (int iRow = 0; iRow < new_num_row; iRow++) {
+    for (int iEl = ar_start[iRow]; iEl < ar_start[iRow + 1]; iEl++) {
+      const int iPut = a_next[ar_index[iEl]]++;
+      a_index[iPut] = iRow;
+      a_value[iPut] = ar_value[iEl];
+    }
+  }
+
+  std::vector<double> col_cost(new_num_col);
+  std::vector<double> col_lower(new_num_col);
+  std::vector<double> col_upper(new_num_col);
+  std::vector<int> integrality(new_num_col);
+  std::vector<std::string> col_names;
+  const bool have_col_names = (int)mip.col_names_.size() == num_col_;
+  for (int iCol = 0; iCol < new_num_col; iCol++) {
+    const int original_col = col_map_[iCol];
+    col_cost[iCol] = mip.colCost_[original_col];
+    col_lower[iCol] = col_lower_[original_col];
+    col_upper[iCol] = col_upper_[original_col];
+    integrality[iCol] = integrality_[original_col];
+    if (have_col_names) col_names.push_back(mip.col_names_[original_col]);
+  }
+
+  mip.numCol_ = new_num_col;
+  mip.numRow_ = new_num_row;
+  mip.Astart_ = std::move(a_start);
+  mip.Aindex_ = std::move(a_index);
+  mip.Avalue_ = std::move(a_value);
+  mip.colCost_ = std::move(col_cost);
+  mip.colLower_ = std::move(col_lower);
+  mip.colUpper_ = std::move(col_upper);
+  mip.rowLower_ = std::move(row_lower);
+  mip.rowUpper_ = std::move(row_upper);
+  mip.integrality_ = std::move(integrality);
+  mip.col_names_ = std::move(col_names);
+  mip.row_names_ = std::move(row_names);
+}
@@ -0,0 +1,115 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef MIP_HIGHS_MIP_PRESOLVE_H_
+#define MIP_HIGHS_MIP_PRESOLVE_H_
+
+#include <vector>
+
+#include "lp_data/HighsLp.h"
+
+enum class HighsMipPresolveStatus { kNotReduced = 0, kReduced, kInfeasible };
+
+// Counts of the reductions made by MIP presolve
+struct HighsMipPresolveInfo {
+  int num_removed_row = 0;
+  int num_removed_col = 0;
+  int num_tightened_bound = 0;
+  int num_tightened_coefficient = 0;
+  int num_dual_fixed = 0;
+  int num_implied_integer = 0;
+  int num_clique_row = 0;
+};
+
+// Presolve for MIPs, using only reductions that keep at least one
+// optimal integer solution. Integer bounds are rounded and tightened
+// using the rows, singleton and redundant rows are removed,
+// coefficients of integer columns in one-sided rows are tightened,
+// columns that can't make any row infeasible are fixed at their best
+// bound, continuous columns whose values are implied to be integer
+// are made integer, and clique rows are extracted from knapsack rows
+// of binary columns. Fixed columns are removed, and postsolve maps a
+// solution of the reduced MIP to the original MIP.
+class HighsMipPresolve {
+ public:
+  // Replace the MIP by the reduced MIP. It's left unchanged if it's
+  // found to be infeasible, or if no reductions are made
+  HighsMipPresolveStatus presolve(HighsLp& mip,
+                                  const double feasibility_tolerance);
+
+  // Form the solution of the original MIP from a solution of the
+  // reduced MIP
+  void postsolve(const std::vector<double>& reduced_solution,
+                 std::vector<double>& solution) const;
+
+  const HighsMipPresolveInfo& info() const { return info_; }
+
+ private:
+  // Each of these returns false if the MIP is found to be infeasible
+  bool roundBounds();
+  bool reduceRow(const int row);
+  bool tightenIntegerBounds(const int row);
+  bool changeBound(const int col, double lower, double upper);
+
+  void computeRowActivity(const int row);
+  void tightenCoefficients(const int row);
+  void fixDualColumns();
+  void detectImpliedIntegers();
+  void extractCliques();
+  void formReducedMip(HighsLp& mip);
+
+  double feasibility_tolerance_ = 0;
+  int num_col_ = 0;
+  int num_row_ = 0;
+  // Whether the current pass has made a reduction
+  bool changed_ = false;
+
+  // The MIP being reduced, with its matrix held row-wise and costs
+  // for minimization. Fixed columns and removed rows stay in the
+  // matrix until the reduced MIP is formed
+  std::vector<double> col_cost_;
+  std::vector<double> col_lower_;
+  std::vector<double> col_upper_;
+  std::vector<int> integrality_;
+  std::vector<double> row_lower_;
+  std::vector<double> row_upper_;
+  std::vector<int> ar_start_;
+  std::vector<int> ar_index_;
+  std::vector<double> ar_value_;
+  std::vector<int> row_removed_;
+
+  // Row activity bounds for the current column bounds
+  std::vector<double> min_activity_;
+  std::vector<double> max_activity_;
+  std::vector<int> num_inf_min_activity_;
+  std::vector<int> num_inf_max_activity_;
+
+  // Clique rows sum_{j in clique} x_j <= 1 to be added
+  std::vector<int> clique_start_;
+  std::vector<int> clique_index_;
+
+  // For postsolve: the column of the original MIP for each column of
+  // the reduced MIP, and the values of the removed columns
+  int original_num_col_ = 0;
+  std::vector<int> col_map_;
+  std::vector<double> removed_col_value_;
+
+  HighsMipPresolveInfo info_;
+};
+
+// Presolve makes at most mip_presolve_max_passes passes over the
+// rows, stopping when a pass makes no reduction. Bounds and
+// coefficients are only changed by more than mip_presolve_min_change
+// (relative), and bounds implied by rows are ignored if they exceed
+// mip_presolve_max_implied_bound in magnitude.
+const int mip_presolve_max_passes = 10;
+const double mip_presolve_min_change = 1e-9;
+const double mip_presolve_max_implied_bound = 1e9;
+
+#endif
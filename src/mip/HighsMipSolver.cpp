@@ -9,19 +9,39 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "mip/HighsMipSolver.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <map>
+#include <thread>
+
+#include "HConfig.h"
 #include "lp_data/HighsModelUtils.h"
+#include "simplex/HighsSimplexInterface.h"
+
+#ifdef OPENMP
+#include "omp.h"
+#endif
 
 // Branch-and-bound code below here:
 // Solve a mixed integer problem using branch and bound.
 HighsMipStatus HighsMipSolver::runMipSolver() {
-  std::cout << "Warning: HiGHS MIP solver is under construction at the moment."
-            << std::endl
-            << "Running HiGHS MIP solver..." << std::endl;
+  // Sub-MIPs are solved with message_level zero, so are silent
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_ALWAYS,
+                    "Warning: HiGHS MIP solver is under construction at the "
+                    "moment.\nRunning HiGHS MIP solver...\n");
 
   // Start timer.
   timer_.startRunHighsClock();
   double mip_solve_initial_time = timer_.readRunHighsClock();
 
+  if (!presolveMip()) {
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL, "MIP presolve has found the MIP to be "
+                      "infeasible\n");
+    return HighsMipStatus::kRootNodeNotOptimal;
+  }
+
   // Load root node lp in highs and turn printing off.
   passModel(mip_);
   // Set the options for this Highs instance according to the options for the
@@ -29,7 +49,7 @@ HighsMipStatus HighsMipSolver::runMipSolver() {
   options_ = options_mip_;
 
   // Report deviations from default options settings
-  writeHighsOptions("");
+  if (options_.message_level) writeHighsOptions("");
   options_.message_level = 0;
 
   const bool only_write_as_mps = false;  // true;//
@@ -40,28 +60,64 @@ HighsMipStatus HighsMipSolver::runMipSolver() {
     //    writeModel(""); options_.message_level=4;
     return HighsMipStatus::kUnderDevelopment;
   }
-  HighsMipStatus root_solve_status = solveRootNode();
+#ifdef OPENMP
+  concurrent_root_ =
+      options_.mip_root_concurrent &&
+      std::min(options_.mip_threads, omp_get_max_threads()) > 1;
+#endif
+  HighsMipStatus root_solve_status =
+      concurrent_root_ ? solveRootNodeConcurrent() : solveRootNode();
+  root_lp_objective_ = info_.objective_function_value;
+  if (root_solve_status == HighsMipStatus::kRootNodeOptimal &&
+      options_.mip_root_cut_rounds > 0)
+    root_solve_status = solveRootCutLoop();
   num_nodes_solved++;
   root_objective_ = info_.objective_function_value;
-  reportMipSolverProgressLine("", true);
+  if (options_.mip_report_level) reportMipSolverProgressLine("", true);
   reportMipSolverProgress(root_solve_status);
   if (root_solve_status != HighsMipStatus::kRootNodeOptimal)
     return root_solve_status;
 
   // Start tree by making root node.
   // Highs ignores integrality constraints.
-  Node root(-1, 0.0, 0, 0);
-  root.col_lower_bound = lp_.colLower_;
-  root.col_upper_bound = lp_.colUpper_;
-  root.integer_variables = lp_.integrality_;
-  root.primal_solution = solution_.col_value;
+  Node root(nullptr, 0.0, 0, 0);
+  tree_.setup(lp_.integrality_, lp_.colLower_, lp_.colUpper_);
+  tree_.setupSolutionPool(options_.mip_pool_size, options_.mip_pool_gap);
+  for (int ix = 0; ix < (int)root_concurrent_objective_.size(); ix++)
+    tree_.updateIncumbent(root_concurrent_solution_[ix],
+                          root_concurrent_objective_[ix]);
   root.objective_value = info_.objective_function_value;
+  if (options_.mip_symmetry) {
+    const double symmetry_start_time = timer_.getWallTime();
+    symmetry_.detect(mip_);
+    symmetry_time_ = timer_.getWallTime() - symmetry_start_time;
+    if (symmetry_.numGenerators()) tree_.setSymmetry(&symmetry_);
+  }
+  if (!options_.mip_resume_file.empty()) resumed_ = resumeFromCheckpoint();
+  runRootHeuristics();
+  if (options_.mip_reduced_cost_fixing) {
+    std::vector<int> set;
+    std::vector<double> lower;
+    std::vector<double> upper;
+    num_reduced_cost_fixed +=
+        reducedCostFixing(*this, root, nullptr, set, lower, upper);
+  }
 
-  //  writeSolutionForIntegerVariables(root);
+  //  writeSolutionForIntegerVariables();
 
   // Add and solve children.
   HighsMipStatus tree_solve_status = solveTree(root);
   reportMipSolverProgress(tree_solve_status);
+  // The optimal objective value is bounded by the incumbent, the
+  // open nodes and any nodes abandoned when the search stopped
+  dual_bound_ = tree_.getBestObjective();
+  int best_node;
+  if (tree_.getNumNodesLeft() > 0)
+    dual_bound_ = std::min(tree_.getBestBound(best_node), dual_bound_);
+  for (const Node* node : unfinished_node_)
+    dual_bound_ = std::min(node->lower_bound, dual_bound_);
+  if (!options_.mip_checkpoint_file.empty()) writeCheckpoint();
+  postsolveMipSolution();
 
   // Stop and read the HiGHS clock, then work out time for this call
   double mip_solve_final_time = timer_.readRunHighsClock();
@@ -83,8 +139,141 @@ HighsMipStatus HighsMipSolver::runMipSolver() {
 
   HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_MINIMAL,
                     "Number of IFS found      = %9d\n", num_integer_solutions);
+  if (options_mip_.mip_presolve) {
+    const HighsMipPresolveInfo& presolve_info = presolve_.info();
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL,
+                      "MIP presolve             = %9d rows and %d columns "
+                      "removed (%.3fs)\n",
+                      presolve_info.num_removed_row,
+                      presolve_info.num_removed_col, presolve_time_);
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL,
+                      "                           %d bounds and %d "
+                      "coefficients tightened, %d dual fixed, %d implied "
+                      "integer, %d clique rows\n",
+                      presolve_info.num_tightened_bound,
+                      presolve_info.num_tightened_coefficient,
+                      presolve_info.num_dual_fixed,
+                      presolve_info.num_implied_integer,
+                      presolve_info.num_clique_row);
+  }
+  if (num_root_cut_rounds) {
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL,
+                      "Root cuts                = %9d (%d rounds, %.3fs): "
+                      "bound %.6g -> %.6g",
+                      num_root_cuts, num_root_cut_rounds, root_cut_time,
+                      root_lp_objective_, root_objective_);
+    const double best_objective = tree_.getBestObjective();
+    if (best_objective < HIGHS_CONST_INF &&
+        best_objective > root_lp_objective_)
+      HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                        ML_MINIMAL, "; gap closed %.1f%%",
+                        100 * (root_objective_ - root_lp_objective_) /
+                            (best_objective - root_lp_objective_));
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL, "\n");
+  }
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_MINIMAL,
+                    "Branching rule           = %s\n",
+                    mipBranchingRuleToString(options_mip_.mip_branching_rule)
+                        .c_str());
+  if (num_strong_branching_lp)
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL,
+                      "Strong branching LPs     = %9d (%d iterations)\n",
+                      num_strong_branching_lp,
+                      total_strong_branching_iterations);
+  if (options_mip_.mip_domain_propagation)
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL,
+                      "Domain propagation       = %9d nodes pruned (%.3fs)\n",
+                      num_nodes_propagation_pruned, total_propagation_time);
+  if (options_mip_.mip_domain_propagation &&
+      options_mip_.mip_conflict_analysis)
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL,
+                      "Conflict analysis        = %9d conflicts (%d nodes "
+                      "pruned, %.3fs)\n",
+                      num_conflicts, num_nodes_conflict_pruned, conflict_time);
+  if (resumed_ || num_checkpoints_)
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL,
+                      "MIP checkpoints          = %9d written%s\n",
+                      num_checkpoints_,
+                      resumed_ ? " (search resumed from a checkpoint)" : "");
+  if (options_mip_.mip_pool_size)
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL, "Solution pool            = %9d solutions\n",
+                      (int)mip_pool_objective_.size());
+  if (options_mip_.mip_symmetry) {
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL,
+                      "Symmetry detection       = %9d generators (group size "
+                      "10^%.1f, %.3fs)\n",
+                      symmetry_.numGenerators(), symmetry_.log10GroupSize(),
+                      symmetry_time_);
+    if (symmetry_.numGenerators())
+      HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                        ML_MINIMAL,
+                        "Orbital fixing           = %9d bounds tightened\n",
+                        tree_.getNumOrbitalFixed());
+  }
+
+  // Dual simplex abandons a node LP as soon as its objective exceeds
+  // the cutoff, so comparing the average number of iterations for such
+  // LPs with that for optimal node LPs indicates what's saved
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_MINIMAL,
+                    "Node LPs cut off         = %9d", num_nodes_lp_cutoff);
+  if (num_nodes_lp_cutoff && num_nodes_lp_optimal)
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL,
+                      " (%.1f iterations each; %.1f for optimal node LPs)",
+                      (double)node_lp_cutoff_iterations / num_nodes_lp_cutoff,
+                      (double)node_lp_optimal_iterations /
+                          num_nodes_lp_optimal);
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level, ML_MINIMAL,
+                    "\n");
+  if (options_mip_.mip_branching_penalty)
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL,
+                      "Branching penalties      = %9d nodes pruned without "
+                      "LP solve\n",
+                      num_nodes_penalty_pruned);
+  if (options_mip_.mip_reduced_cost_fixing)
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL,
+                      "Reduced cost fixing      = %9d bounds tightened\n",
+                      num_reduced_cost_fixed);
+  if (options_mip_.mip_heuristic_effort > 0)
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL,
+                      "Heuristic solutions      = %9d (rounding %d, diving %d, "
+                      "sub-MIP %d; %d iterations, %.3fs)\n",
+                      num_rounding_solutions + num_diving_solutions +
+                          num_sub_mip_solutions,
+                      num_rounding_solutions, num_diving_solutions,
+                      num_sub_mip_solutions, heuristic_simplex_iterations,
+                      heuristic_time);
+  if (concurrent_root_)
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL,
+                      "Concurrent root          = %9.3fs (dual simplex "
+                      "%.3fs, IPX %.3fs; trivial %d, pump %d solutions)\n",
+                      root_time_, root_simplex_time_, root_ipm_time_,
+                      num_trivial_solutions, num_pump_solutions);
+  if (first_incumbent_time_ >= 0)
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL, "First IFS found after    = %9.3fs\n",
+                      first_incumbent_time_ - mip_solve_initial_time);
 
   if (tree_.getBestSolution().size() > 0) {
+    if (!mip_solution_feasible_)
+      HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                        ML_MINIMAL,
+                        "Warning: the solution of the original MIP is not "
+                        "feasible\n");
     if (num_nodes_unsolved)
       HighsPrintMessage(options_mip_.output, options_mip_.message_level,
                         ML_MINIMAL, "ERROR: number of nodes unsolved = %9d\n",
@@ -110,24 +299,67 @@ HighsMipStatus HighsMipSolver::runMipSolver() {
   }
 
   if (tree_solve_status != HighsMipStatus::kTreeExhausted) {
-    std::cout << "Warning: tree not explored entirely." << std::endl;
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_ALWAYS, "Warning: tree not explored entirely.\n");
     return tree_solve_status;
   }
 
   return HighsMipStatus::kUnderDevelopment;
 }
 
+HighsModelStatus HighsMipSolver::getMipModelStatus(
+    const HighsMipStatus mip_status) const {
+  switch (mip_status) {
+    case HighsMipStatus::kOptimal:
+    case HighsMipStatus::kTreeExhausted:
+    case HighsMipStatus::kUnderDevelopment:
+      // The search is complete
+      return mip_solution_.empty() ? HighsModelStatus::PRIMAL_INFEASIBLE
+                                   : HighsModelStatus::OPTIMAL;
+    case HighsMipStatus::kRootNodeNotOptimal:
+      // The MIP presolve or the root node LP has found the MIP to be
+      // infeasible, or the root node LP has stopped otherwise
+      if (model_status_ == HighsModelStatus::NOTSET)
+        return HighsModelStatus::PRIMAL_INFEASIBLE;
+      return model_status_;
+    case HighsMipStatus::kTimeout:
+      return HighsModelStatus::REACHED_TIME_LIMIT;
+    case HighsMipStatus::kReachedSimplexIterationLimit:
+    case HighsMipStatus::kMaxNodeReached:
+      return HighsModelStatus::REACHED_ITERATION_LIMIT;
+    case HighsMipStatus::kInterrupted:
+      return HighsModelStatus::REACHED_INTERRUPT;
+    default:
+      return HighsModelStatus::SOLVE_ERROR;
+  }
+}
+
 #ifdef HiGHSDEV
-void HighsMipSolver::writeSolutionForIntegerVariables(Node& node) {
+void HighsMipSolver::writeSolutionForIntegerVariables() {
   for (int iCol = 0; iCol < lp_.numCol_; iCol++) {
     if (!lp_.integrality_[iCol]) continue;
-    printf("%2d [%10.4g, %10.4g, %10.4g]\n", iCol, node.col_lower_bound[iCol],
-           node.primal_solution[iCol], node.col_upper_bound[iCol]);
+    printf("%2d [%10.4g, %10.4g, %10.4g]\n", iCol, lp_.colLower_[iCol],
+           solution_.col_value[iCol], lp_.colUpper_[iCol]);
   }
 }
 #endif
 
-HighsMipStatus HighsMipSolver::solveNode(Node& node, bool hotstart) {
+HighsMipStatus HighsMipSolver::solveNode(HighsMipWorker& worker, Node& node,
+                                         bool hotstart) {
+  Highs& highs = worker.highs;
+  worker.node_simplex_iterations = 0;
+  worker.strong_branching_gain.clear();
+  worker.strong_branching_preferred_col = -1;
+  worker.num_strong_branching_lp = 0;
+  worker.strong_branching_iterations = 0;
+  worker.propagation_infeasible = false;
+  worker.propagation_time = 0;
+  worker.conflict.clear();
+  worker.conflict_pruned = false;
+  worker.conflict_time = 0;
+  worker.lp_cutoff = false;
+  worker.num_reduced_cost_fixed = 0;
+  worker.heuristic_node_count = -1;
   // Force calls within run() to be silent by setting the HiGHS
   // logfile to NULL and the HiGHS message_level to zero.
   bool no_highs_log = true;
@@ -140,6 +372,8 @@ HighsMipStatus HighsMipSolver::solveNode(Node& node, bool hotstart) {
   HighsStatus return_status = HighsStatus::OK;
   HighsStatus call_status;
   HighsModelStatus use_model_status = HighsModelStatus::NOTSET;
+  // The objective value at which dual simplex abandons the node LP
+  double cutoff = HIGHS_CONST_INF;
 
   // When full_highs_log is true, run() is verbose - for debugging
   bool full_highs_log = false;
@@ -153,78 +387,155 @@ HighsMipStatus HighsMipSolver::solveNode(Node& node, bool hotstart) {
     // stop on this line
     full_highs_log = true;
     //    options_.mip_report_level = 2;
-    printf("node%d: %d; %d\n", check_node_id, lp_.numCol_, lp_.numRow_);
+    printf("node%d: %d; %d\n", check_node_id, highs.lp_.numCol_,
+           highs.lp_.numRow_);
   }
   if (hotstart) {
     // Apply changes to LP from node. For the moment only column bounds.
     // Get the original message_level and logfile in case they are set to
     // something different for run()
-    save_message_level = options_.message_level;
-    save_logfile = options_.logfile;
-    save_presolve = options_.presolve;
+    save_message_level = highs.options_.message_level;
+    save_logfile = highs.options_.logfile;
+    save_presolve = highs.options_.presolve;
     if (full_highs_log) {
       // Using full logging, so prevent "no logging"
       no_highs_log = false;
-      options_.message_level = 7;
-      options_.logfile = stdout;
+      highs.options_.message_level = 7;
+      highs.options_.logfile = stdout;
     }
     if (no_highs_log) {
       // Using no logging, so prevent it
-      options_.message_level = 0;
-      options_.logfile = NULL;
+      highs.options_.message_level = 0;
+      highs.options_.logfile = NULL;
     }
 
-    changeColsBounds(0, mip_.numCol_ - 1, &node.col_lower_bound[0],
-                     &node.col_upper_bound[0]);
+    // Only the bounds which differ from those of the node whose LP
+    // was last solved need to be changed
+    assert(worker.lp_node != nullptr);
+    tree_.getBoundChange(*worker.lp_node, node, worker.bound_change_set,
+                         worker.bound_change_lower, worker.bound_change_upper,
+                         worker.col_set_position);
+    const int num_bound_change = worker.bound_change_set.size();
+    if (options_.mip_domain_propagation) {
+      // Propagate the bound changes through the rows, recording the
+      // implied bound changes with the node. If the bounds are found
+      // to be infeasible, the node is pruned without solving its LP.
+      const double propagation_start_time = timer_.getWallTime();
+      HighsDomain& domain = worker.domain;
+      if (options_.mip_conflict_analysis) {
+        // Add the conflicts found by any worker since the last node
+#ifdef OPENMP
+#pragma omp critical(mip_tree)
+#endif
+        for (; worker.num_conflict_synced < conflict_pool_.size();
+             worker.num_conflict_synced++)
+          domain.addConflict(conflict_pool_, worker.num_conflict_synced);
+      }
+      for (int ix = 0; ix < num_bound_change; ix++)
+        domain.changeBound(worker.bound_change_set[ix],
+                           worker.bound_change_lower[ix],
+                           worker.bound_change_upper[ix]);
+      if (domain.propagate()) {
+        domain.getPropagation(node.implied_col, node.implied_col_lower,
+                              node.implied_col_upper);
+      } else {
+        worker.conflict_pruned = domain.conflictInfeasible();
+        domain.undoPropagation();
+        worker.propagation_infeasible = true;
+      }
+      worker.propagation_time +=
+          timer_.getWallTime() - propagation_start_time;
+    }
+    if (num_bound_change)
+      highs.changeColsBounds(num_bound_change, &worker.bound_change_set[0],
+                             &worker.bound_change_lower[0],
+                             &worker.bound_change_upper[0]);
+    const int num_implied_bound_change = node.implied_col.size();
+    if (num_implied_bound_change)
+      highs.changeColsBounds(num_implied_bound_change, &node.implied_col[0],
+                             &node.implied_col_lower[0],
+                             &node.implied_col_upper[0]);
+    if (worker.propagation_infeasible) {
+      worker.lp_node = &node;
+      highs.options_.message_level = save_message_level;
+      highs.options_.logfile = save_logfile;
+      highs.options_.presolve = save_presolve;
+      return HighsMipStatus::kNodeInfeasible;
+    }
+    // Unless the LP has just been solved for the node's parent, warm
+    // start from the parent's optimal basis
+    Node* parent = node.parent;
+    if (worker.lp_node != parent && parent != nullptr &&
+        !parent->basis.empty()) {
+      parent->basis.unpack(worker.basis);
+      highs.setBasis(worker.basis);
+    }
+    worker.lp_node = &node;
 
     if (node.id == check_node_id) {
       printf("Writing node%1d.mps\n", check_node_id);
-      writeModel("node33663.mps");
-      //      basis_.valid_ = false; options_.presolve = on_string;
+      highs.writeModel("node33663.mps");
+      //      basis_.valid_ = false; highs.options_.presolve = on_string;
     }
 
-    call_status = run();
-    return_status = interpretCallStatus(call_status, return_status, "run()");
+    // Dual simplex abandons the LP once its objective can't be better
+    // than the incumbent
+    const double save_dual_objective_value_upper_bound =
+        highs.options_.dual_objective_value_upper_bound;
+    cutoff = std::min(tree_.getBestObjective(),
+                      save_dual_objective_value_upper_bound);
+    highs.options_.dual_objective_value_upper_bound = cutoff;
+    // Only column bounds and possibly the basis have changed since the
+    // last LP was solved, so re-solve with dual simplex from its
+    // matrix and factor data rather than calling run()
+    call_status = highs.resolveDual();
+    highs.options_.dual_objective_value_upper_bound =
+        save_dual_objective_value_upper_bound;
+    return_status =
+        interpretCallStatus(call_status, return_status, "resolveDual()");
     if (return_status == HighsStatus::Error) return HighsMipStatus::kNodeError;
-    total_simplex_iterations += info_.simplex_iteration_count;
+    // The HiGHS info is cleared when the LP is abandoned, but the
+    // iteration counts of the model object are not
+    worker.node_simplex_iterations =
+        highs.hmos_.empty() ? highs.info_.simplex_iteration_count
+                            : highs.hmos_[0].iteration_counts_.simplex;
 
-    call_status = getUseModelStatus(use_model_status,
-                                    unscaled_primal_feasibility_tolerance,
-                                    unscaled_dual_feasibility_tolerance, true);
+    call_status = highs.getUseModelStatus(
+        use_model_status, unscaled_primal_feasibility_tolerance,
+        unscaled_dual_feasibility_tolerance, true);
     return_status =
         interpretCallStatus(call_status, return_status, "getUseModelStatus()");
     if (return_status == HighsStatus::Error) return HighsMipStatus::kNodeError;
 
     // Reset the values of message_level and logfile
-    options_.message_level = save_message_level;
-    options_.logfile = save_logfile;
-    options_.presolve = save_presolve;
+    highs.options_.message_level = save_message_level;
+    highs.options_.logfile = save_logfile;
+    highs.options_.presolve = save_presolve;
     const bool check_hotstart = false;  // true;//
     if (check_hotstart) {
       HighsModelStatus hotstart_model_status = use_model_status;
-      double hotstart_objective = info_.objective_function_value;
+      double hotstart_objective = highs.info_.objective_function_value;
 
-      Highs highs;
+      Highs check_highs;
       if (no_highs_log) {
-        highs.options_.logfile = NULL;
-        highs.options_.message_level = 0;
+        check_highs.options_.logfile = NULL;
+        check_highs.options_.message_level = 0;
       } else if (full_highs_log) {
-        highs.options_.message_level = 4;
+        check_highs.options_.message_level = 4;
       }
       HighsLp lp_node = mip_;
-      lp_node.colLower_ = node.col_lower_bound;
-      lp_node.colUpper_ = node.col_upper_bound;
-      highs.passModel(lp_node);
+      tree_.getNodeBounds(node, lp_node.colLower_, lp_node.colUpper_);
+      check_highs.passModel(lp_node);
 
-      highs.options_.presolve = off_string;
-      if (node.id == check_node_id) highs.options_.presolve = on_string;
-      call_status = highs.run();
+      check_highs.options_.presolve = off_string;
+      if (node.id == check_node_id) check_highs.options_.presolve = on_string;
+      call_status = check_highs.run();
       return_status = interpretCallStatus(call_status, return_status, "run()");
       if (return_status == HighsStatus::Error)
         return HighsMipStatus::kNodeError;
 
       HighsModelStatus check_model_status;
-      call_status = highs.getUseModelStatus(
+      call_status = check_highs.getUseModelStatus(
           check_model_status, unscaled_primal_feasibility_tolerance,
           unscaled_dual_feasibility_tolerance);
       return_status = interpretCallStatus(
@@ -232,7 +543,7 @@ HighsMipStatus HighsMipSolver::solveNode(Node& node, bool hotstart) {
       if (return_status == HighsStatus::Error)
         return HighsMipStatus::kNodeError;
 
-      double check_objective = highs.info_.objective_function_value;
+      double check_objective = check_highs.info_.objective_function_value;
       if (check_model_status != hotstart_model_status) {
         // Check whether the model status is the same
         printf(
@@ -259,19 +570,18 @@ HighsMipStatus HighsMipSolver::solveNode(Node& node, bool hotstart) {
     }
   } else {
     // solve from scratch to test
-    Highs highs;
-    highs.options_.message_level = 0;
+    Highs check_highs;
+    check_highs.options_.message_level = 0;
     HighsLp lp_node = mip_;
-    lp_node.colLower_ = node.col_lower_bound;
-    lp_node.colUpper_ = node.col_upper_bound;
-    highs.passModel(lp_node);
-    call_status = highs.run();
+    tree_.getNodeBounds(node, lp_node.colLower_, lp_node.colUpper_);
+    check_highs.passModel(lp_node);
+    call_status = check_highs.run();
     return_status = interpretCallStatus(call_status, return_status, "run()");
     if (return_status == HighsStatus::Error) return HighsMipStatus::kNodeError;
 
-    call_status = highs.getUseModelStatus(use_model_status,
-                                          unscaled_primal_feasibility_tolerance,
-                                          unscaled_dual_feasibility_tolerance);
+    call_status = check_highs.getUseModelStatus(
+        use_model_status, unscaled_primal_feasibility_tolerance,
+        unscaled_dual_feasibility_tolerance);
     return_status = interpretCallStatus(call_status, return_status,
                                         "getUseModelStatus(use_model_status)");
     if (return_status == HighsStatus::Error) return HighsMipStatus::kNodeError;
@@ -283,6 +593,8 @@ HighsMipStatus HighsMipSolver::solveNode(Node& node, bool hotstart) {
         return HighsMipStatus::kTimeout;
       if (use_model_status == HighsModelStatus::REACHED_ITERATION_LIMIT)
         return HighsMipStatus::kReachedSimplexIterationLimit;
+      if (use_model_status == HighsModelStatus::REACHED_INTERRUPT)
+        return HighsMipStatus::kInterrupted;
       return HighsMipStatus::kNodeNotOptimal;
     case HighsStatus::Error:
       return HighsMipStatus::kNodeError;
@@ -292,10 +604,27 @@ HighsMipStatus HighsMipSolver::solveNode(Node& node, bool hotstart) {
 
   switch (use_model_status) {
     case HighsModelStatus::OPTIMAL:
-      node.primal_solution = solution_.col_value;
-      node.objective_value = info_.objective_function_value;
+      node.objective_value = highs.info_.objective_function_value;
+      worker.primal_solution = highs.solution_.col_value;
+      if (options_.mip_branching_rule == MIP_BRANCHING_RULE_RELIABILITY)
+        strongBranch(worker, node);
+      if (hotstart && options_.mip_reduced_cost_fixing)
+        worker.num_reduced_cost_fixed = reducedCostFixing(
+            highs, node,
+            options_.mip_domain_propagation ? &worker.domain : nullptr,
+            worker.bound_change_set, worker.bound_change_lower,
+            worker.bound_change_upper);
       return HighsMipStatus::kNodeOptimal;
+    case HighsModelStatus::REACHED_DUAL_OBJECTIVE_VALUE_UPPER_BOUND:
+      worker.lp_cutoff = true;
+      if (hotstart && options_.mip_domain_propagation &&
+          options_.mip_conflict_analysis)
+        analyzeConflict(worker, cutoff);
+      return HighsMipStatus::kNodeInfeasible;
     case HighsModelStatus::PRIMAL_INFEASIBLE:
+      if (hotstart && options_.mip_domain_propagation &&
+          options_.mip_conflict_analysis)
+        analyzeConflict(worker, HIGHS_CONST_INF);
       return HighsMipStatus::kNodeInfeasible;
     case HighsModelStatus::PRIMAL_UNBOUNDED:
       return HighsMipStatus::kNodeUnbounded;
@@ -303,6 +632,8 @@ HighsMipStatus HighsMipSolver::solveNode(Node& node, bool hotstart) {
       return HighsMipStatus::kTimeout;
     case HighsModelStatus::REACHED_ITERATION_LIMIT:
       return HighsMipStatus::kReachedSimplexIterationLimit;
+    case HighsModelStatus::REACHED_INTERRUPT:
+      return HighsMipStatus::kInterrupted;
     case HighsModelStatus::NOTSET:
       return HighsMipStatus::kNodeError;
     default:
@@ -336,6 +667,8 @@ HighsMipStatus HighsMipSolver::solveRootNode() {
 
   switch (lp_solve_status) {
     case HighsStatus::Warning:
+      if (use_model_status == HighsModelStatus::REACHED_INTERRUPT)
+        return HighsMipStatus::kInterrupted;
       return HighsMipStatus::kRootNodeNotOptimal;
     case HighsStatus::Error:
       return HighsMipStatus::kRootNodeError;
@@ -349,6 +682,494 @@ HighsMipStatus HighsMipSolver::solveRootNode() {
   return HighsMipStatus::kRootNodeOptimal;
 }
 
+HighsMipStatus HighsMipSolver::solveRootNodeConcurrent() {
+  // Dual simplex solves the root node LP on this thread, since the
+  // tree search needs its optimal basis. On another thread, the
+  // trivial heuristics are followed by IPX without crossover, whose
+  // interior point is the start of a feasibility pump. These stop
+  // when the simplex solve has finished. The solutions found are
+  // offered to the tree once it has been set up.
+  const double start_time = timer_.getWallTime();
+  // Only this thread uses the HiGHS clocks, so the times at which the
+  // other finds solutions are recorded using the wall time
+  const double run_clock_offset = timer_.readRunHighsClock() - start_time;
+  std::atomic<bool> root_done(false);
+  HighsOptions ipm_options = options_;
+  ipm_options.logfile = NULL;
+  ipm_options.message_level = 0;
+  ipm_options.presolve = off_string;
+  ipm_options.solver = ipm_string;
+  ipm_options.run_crossover = false;
+  Highs ipm_highs(ipm_options);
+  ipm_highs.passModel(mip_);
+  HighsPrimalHeuristics root_heuristics;
+  root_heuristics.setupLocks(mip_, options_);
+
+  auto recordSolution = [&](const std::vector<double>& solution,
+                            const double objective) {
+    if (first_incumbent_time_ < 0)
+      first_incumbent_time_ = timer_.getWallTime() + run_clock_offset;
+    root_concurrent_solution_.push_back(solution);
+    root_concurrent_objective_.push_back(objective);
+  };
+
+  HighsMipStatus root_solve_status = HighsMipStatus::kRootNodeError;
+#pragma omp parallel sections num_threads(2)
+  {
+#pragma omp section
+    {
+      root_solve_status = solveRootNode();
+      root_simplex_time_ = timer_.getWallTime() - start_time;
+      root_done = true;
+      ipm_highs.requestInterrupt();
+    }
+#pragma omp section
+    {
+      std::vector<double> solution;
+      double objective;
+      if (root_heuristics.trivial(solution, objective)) {
+        recordSolution(solution, objective);
+        num_trivial_solutions++;
+      }
+      if (!root_done) {
+        HighsStatus ipm_status = ipm_highs.run();
+        root_ipm_time_ = timer_.getWallTime() - start_time;
+        int iteration_count = 0;
+        if (ipm_status == HighsStatus::OK &&
+            ipm_highs.getModelStatus() == HighsModelStatus::OPTIMAL &&
+            root_heuristics.feasibilityPump(
+                ipm_highs.getSolution().col_value, HIGHS_CONST_I_INF,
+                root_done, solution, objective, iteration_count)) {
+          recordSolution(solution, objective);
+          num_pump_solutions++;
+        }
+        heuristic_simplex_iterations += iteration_count;
+      }
+    }
+  }
+  root_time_ = timer_.getWallTime() - start_time;
+  return root_solve_status;
+}
+
+HighsMipStatus HighsMipSolver::solveRootCutLoop() {
+  // Separate cuts from the optimal solution of the root LP relaxation
+  // and add the most efficacious to the LP, which is then re-solved
+  // from the current basis with dual simplex. Cut rows whose logicals
+  // remain basic are removed from the LP.
+  const double start_time = timer_.getWallTime();
+  HighsCutPool cut_pool;
+  cut_pool.setup(lp_.numCol_);
+  HighsSeparation separation;
+  separation.setup(mip_, options_.primal_feasibility_tolerance);
+  HighsCutSet cut_set;
+  // The cut rows of the LP follow those of the MIP, and cut_row_age
+  // is the number of consecutive rounds for which each has been basic
+  std::vector<int> cut_row_age;
+  std::vector<int> delete_row;
+
+  int save_message_level = options_.message_level;
+  FILE* save_logfile = options_.logfile;
+  options_.logfile = NULL;
+  options_.message_level = 0;
+
+  auto resolve = [&]() {
+    HighsStatus run_status = run();
+    total_simplex_iterations += info_.simplex_iteration_count;
+    if (run_status == HighsStatus::Error)
+      return HighsMipStatus::kRootNodeError;
+    if (model_status_ == HighsModelStatus::REACHED_INTERRUPT)
+      return HighsMipStatus::kInterrupted;
+    if (model_status_ != HighsModelStatus::OPTIMAL)
+      return HighsMipStatus::kRootNodeNotOptimal;
+    return HighsMipStatus::kRootNodeOptimal;
+  };
+
+  HighsMipStatus return_status = HighsMipStatus::kRootNodeOptimal;
+  double objective = info_.objective_function_value;
+  int num_stall_round = 0;
+  for (int round = 0; round < options_.mip_root_cut_rounds; round++) {
+    const std::vector<double>& col_value = solution_.col_value;
+    separation.separateGomory(*this, cut_pool);
+    separation.separateKnapsackCover(col_value, cut_pool);
+    separation.separateMir(col_value, cut_pool);
+    cut_set.clear();
+    cut_pool.separate(col_value, root_cut_max_num_per_round, cut_set);
+    const int num_cut = cut_set.numCut();
+    if (num_cut == 0) break;
+
+    std::vector<double> cut_upper(num_cut, HIGHS_CONST_INF);
+    if (!addRows(num_cut, &cut_set.lower[0], &cut_upper[0],
+                 cut_set.index.size(), &cut_set.start[0], &cut_set.index[0],
+                 &cut_set.value[0])) {
+      return_status = HighsMipStatus::kRootNodeError;
+      break;
+    }
+    num_root_cuts += num_cut;
+    num_root_cut_rounds++;
+    cut_row_age.resize(cut_row_age.size() + num_cut, 0);
+    return_status = resolve();
+    if (return_status != HighsMipStatus::kRootNodeOptimal) break;
+
+    // Remove the cut rows that have been basic for too long. Since
+    // their logicals are basic, the remaining basis is optimal.
+    const int num_mip_row = mip_.numRow_;
+    const int num_row = lp_.numRow_;
+    delete_row.assign(num_row, 0);
+    int num_delete_row = 0;
+    for (int iRow = num_mip_row; iRow < num_row; iRow++) {
+      int& age = cut_row_age[iRow - num_mip_row];
+      if (basis_.row_status[iRow] != HighsBasisStatus::BASIC) {
+        age = 0;
+      } else if (++age >= root_cut_row_age_limit) {
+        delete_row[iRow] = 1;
+        num_delete_row++;
+      }
+    }
+    if (num_delete_row) {
+      HighsBasis basis = basis_;
+      int num_cut_row = 0;
+      for (int iRow = num_mip_row; iRow < num_row; iRow++) {
+        if (delete_row[iRow]) continue;
+        const int new_row = num_mip_row + num_cut_row;
+        basis.row_status[new_row] = basis.row_status[iRow];
+        cut_row_age[num_cut_row] = cut_row_age[iRow - num_mip_row];
+        num_cut_row++;
+      }
+      basis.row_status.resize(num_mip_row + num_cut_row);
+      cut_row_age.resize(num_cut_row);
+      deleteRows(&delete_row[0]);
+      setBasis(basis);
+      return_status = resolve();
+      if (return_status != HighsMipStatus::kRootNodeOptimal) break;
+    }
+
+    const double new_objective = info_.objective_function_value;
+    if (new_objective - objective <
+        root_cut_min_improvement * std::max(1.0, std::fabs(objective))) {
+      if (++num_stall_round >= root_cut_max_stall_rounds) break;
+    } else {
+      num_stall_round = 0;
+    }
+    objective = new_objective;
+  }
+  options_.logfile = save_logfile;
+  options_.message_level = save_message_level;
+  root_cut_time = timer_.getWallTime() - start_time;
+  return return_status;
+}
+
+bool HighsMipSolver::presolveMip() {
+  if (!options_mip_.mip_presolve) return true;
+  const double presolve_start_time = timer_.readRunHighsClock();
+  const HighsMipPresolveStatus presolve_status =
+      presolve_.presolve(mip_, options_mip_.primal_feasibility_tolerance);
+  presolve_time_ = timer_.readRunHighsClock() - presolve_start_time;
+  presolved_ = presolve_status == HighsMipPresolveStatus::kReduced;
+  return presolve_status != HighsMipPresolveStatus::kInfeasible;
+}
+
+void HighsMipSolver::postsolveMipSolution() {
+  const HighsSolutionPool& solution_pool = tree_.getSolutionPool();
+  const int num_pool_solution = solution_pool.size();
+  mip_pool_objective_.resize(num_pool_solution);
+  mip_pool_solution_.resize(num_pool_solution);
+  for (int index = 0; index < num_pool_solution; index++) {
+    mip_pool_objective_[index] = solution_pool.getObjective(index);
+    if (presolved_)
+      presolve_.postsolve(solution_pool.getSolution(index),
+                          mip_pool_solution_[index]);
+    else
+      mip_pool_solution_[index] = solution_pool.getSolution(index);
+  }
+
+  const std::vector<double>& solution = tree_.getBestSolution();
+  mip_solution_feasible_ = false;
+  if (solution.empty()) {
+    mip_solution_.clear();
+    return;
+  }
+  if (presolved_)
+    presolve_.postsolve(solution, mip_solution_);
+  else
+    mip_solution_ = solution;
+
+  // Check the solution against the original MIP, allowing the
+  // tolerance used for the solutions of node LPs
+  const HighsLp& mip = original_mip_;
+  const double tolerance = unscaled_primal_feasibility_tolerance;
+  std::vector<double> row_activity(mip.numRow_, 0);
+  for (int iCol = 0; iCol < mip.numCol_; iCol++) {
+    const double value = mip_solution_[iCol];
+    for (int iEl = mip.Astart_[iCol]; iEl < mip.Astart_[iCol + 1]; iEl++)
+      row_activity[mip.Aindex_[iEl]] += mip.Avalue_[iEl] * value;
+    if (value < mip.colLower_[iCol] - tolerance ||
+        value > mip.colUpper_[iCol] + tolerance)
+      return;
+    if (!mip.integrality_.empty() && mip.integrality_[iCol] &&
+        std::fabs(value - std::round(value)) > tolerance)
+      return;
+  }
+  for (int iRow = 0; iRow < mip.numRow_; iRow++) {
+    const double value = row_activity[iRow];
+    if (value < mip.rowLower_[iRow] - tolerance ||
+        value > mip.rowUpper_[iRow] + tolerance)
+      return;
+  }
+  mip_solution_feasible_ = true;
+}
+
+void HighsMipSolver::runRootHeuristics() {
+  // Look for an integer feasible solution before branching by
+  // rounding the solution of the root LP relaxation, diving from it,
+  // and solving the sub-MIP in which the integer columns are fixed at
+  // their integer values and restricted to the nearest integers
+  // otherwise (RENS)
+  if (options_.mip_heuristic_effort <= 0) return;
+  const std::vector<double>& root_solution = solution_.col_value;
+  int num_integer = 0;
+  int num_fractional = 0;
+  std::vector<double> col_lower = lp_.colLower_;
+  std::vector<double> col_upper = lp_.colUpper_;
+  for (int iCol = 0; iCol < lp_.numCol_; iCol++) {
+    if (!lp_.integrality_[iCol]) continue;
+    num_integer++;
+    const double value = root_solution[iCol];
+    const double nearest = std::floor(value + 0.5);
+    if (std::fabs(value - nearest) <= integer_tolerance) {
+      col_lower[iCol] = nearest;
+      col_upper[iCol] = nearest;
+    } else {
+      num_fractional++;
+      col_lower[iCol] = std::floor(value);
+      col_upper[iCol] = std::ceil(value);
+    }
+  }
+  // An integral root solution is recorded when the root is branched
+  if (!num_fractional) return;
+
+  const double start_time = timer_.getWallTime();
+  heuristics_.setup(mip_, lp_, basis_, options_);
+  std::vector<double> solution;
+  double objective;
+  if (heuristics_.round(root_solution, solution, objective) &&
+      tree_.updateIncumbent(solution, objective))
+    num_rounding_solutions++;
+  runDive(HighsDiveRule::kFractional, lp_.colLower_, lp_.colUpper_,
+          root_solution);
+  runDive(HighsDiveRule::kCoefficient, lp_.colLower_, lp_.colUpper_,
+          root_solution);
+  if (num_integer - num_fractional >= sub_mip_min_fixing_rate * num_integer)
+    runSubMip(col_lower, col_upper);
+  runDive(HighsDiveRule::kGuided, lp_.colLower_, lp_.colUpper_,
+          root_solution);
+  rins_num_integer_solutions_ = tree_.getNumIntegerSolutions();
+  heuristic_time += timer_.getWallTime() - start_time;
+  recordFirstIncumbentTime();
+}
+
+HighsMipStatus HighsMipSolver::runNodeHeuristics(HighsMipWorker& worker) {
+  // Round the solution of each node LP that is branched on. Every
+  // heuristic_node_frequency nodes, while the budget allows, either
+  // solve the sub-MIP in which the integer columns with the same
+  // values in the node solution and a new incumbent are fixed (RINS),
+  // or dive from the node on the worker's LP using each rule in turn.
+  // The asynchronous search runs the heuristics outside its critical
+  // section, so the tree and heuristic statistics are only accessed
+  // within short critical sections. Returns kNodeError if the LP of
+  // the worker can't be restored after a dive.
+  if (options_.mip_heuristic_effort <= 0) return HighsMipStatus::kNodeOptimal;
+  const double start_time = timer_.getWallTime();
+  const std::vector<double>& node_solution = worker.primal_solution;
+  std::vector<double> solution;
+  double objective;
+  if (heuristics_.round(node_solution, solution, objective)) {
+#ifdef OPENMP
+#pragma omp critical(mip_tree)
+#endif
+    {
+      if (tree_.updateIncumbent(solution, objective)) num_rounding_solutions++;
+    }
+  }
+  bool run_sub_mip = false;
+  bool run_dive = false;
+  bool restored = true;
+  HighsDiveRule rule = HighsDiveRule::kFractional;
+  std::vector<double> incumbent;
+#ifdef OPENMP
+#pragma omp critical(mip_tree)
+#endif
+  {
+    if (worker.heuristic_node_count % heuristic_node_frequency == 0 &&
+        heuristicBudgetAvailable()) {
+      incumbent = tree_.getBestSolution();
+      if (!incumbent.empty() &&
+          tree_.getNumIntegerSolutions() != rins_num_integer_solutions_) {
+        rins_num_integer_solutions_ = tree_.getNumIntegerSolutions();
+        run_sub_mip = true;
+      } else {
+        rule = (HighsDiveRule)next_dive_rule_;
+        next_dive_rule_ = (next_dive_rule_ + 1) % (int)HighsDiveRule::kCount;
+        run_dive = true;
+      }
+    }
+  }
+  if (run_sub_mip) {
+    std::vector<double> col_lower = mip_.colLower_;
+    std::vector<double> col_upper = mip_.colUpper_;
+    int num_integer = 0;
+    int num_fixed = 0;
+    for (int iCol = 0; iCol < mip_.numCol_; iCol++) {
+      if (!mip_.integrality_[iCol]) continue;
+      num_integer++;
+      if (std::fabs(node_solution[iCol] - incumbent[iCol]) > integer_tolerance)
+        continue;
+      num_fixed++;
+      col_lower[iCol] = incumbent[iCol];
+      col_upper[iCol] = incumbent[iCol];
+    }
+    if (num_fixed >= sub_mip_min_fixing_rate * num_integer)
+      runSubMip(col_lower, col_upper);
+  } else if (run_dive) {
+    // The dive changes the bounds of the worker's LP, so they're
+    // copied to be restored afterwards
+    const std::vector<double> col_lower = worker.highs.lp_.colLower_;
+    const std::vector<double> col_upper = worker.highs.lp_.colUpper_;
+    restored = runDive(rule, col_lower, col_upper, node_solution, &worker);
+  }
+#ifdef OPENMP
+#pragma omp critical(mip_tree)
+#endif
+  {
+    heuristic_time += timer_.getWallTime() - start_time;
+    recordFirstIncumbentTime();
+  }
+  return restored ? HighsMipStatus::kNodeOptimal : HighsMipStatus::kNodeError;
+}
+
+bool HighsMipSolver::heuristicBudgetAvailable() const {
+  return heuristic_simplex_iterations <
+         options_.mip_heuristic_effort * total_simplex_iterations +
+             heuristic_min_iterations;
+}
+
+bool HighsMipSolver::runDive(const HighsDiveRule rule,
+                             const std::vector<double>& col_lower,
+                             const std::vector<double>& col_upper,
+                             const std::vector<double>& lp_solution,
+                             HighsMipWorker* worker) {
+  bool budget_available;
+  std::vector<double> incumbent;
+  double cutoff;
+  int iteration_limit;
+#ifdef OPENMP
+#pragma omp critical(mip_tree)
+#endif
+  {
+    budget_available = heuristicBudgetAvailable();
+    incumbent = tree_.getBestSolution();
+    cutoff = tree_.getBestObjective();
+    iteration_limit = options_.mip_heuristic_effort * total_simplex_iterations +
+                      heuristic_min_iterations - heuristic_simplex_iterations;
+  }
+  if (!budget_available) return true;
+  if (rule == HighsDiveRule::kGuided && incumbent.empty()) return true;
+  std::vector<double> solution;
+  double objective;
+  int iteration_count;
+  bool found;
+  bool restored = true;
+  if (worker == nullptr) {
+    found = heuristics_.dive(rule, col_lower, col_upper, lp_solution, incumbent,
+                             cutoff, iteration_limit, solution, objective,
+                             iteration_count);
+  } else {
+    // Dive silently with simplex on the worker's LP, and then restore
+    // its bounds and basis so that the LP of its next node is warm
+    // started as if there had been no dive
+    Highs& highs = worker->highs;
+    const HighsBasis basis = highs.basis_;
+    const int save_message_level = highs.options_.message_level;
+    FILE* save_logfile = highs.options_.logfile;
+    const std::string save_presolve = highs.options_.presolve;
+    const std::string save_solver = highs.options_.solver;
+    highs.options_.message_level = 0;
+    highs.options_.logfile = NULL;
+    highs.options_.presolve = off_string;
+    highs.options_.solver = simplex_string;
+    found = heuristics_.dive(highs, rule, col_lower, col_upper, lp_solution,
+                             incumbent, cutoff, iteration_limit, solution,
+                             objective, iteration_count);
+    restored = highs.changeColsBounds(0, highs.lp_.numCol_ - 1,
+                                      &col_lower[0], &col_upper[0]) &&
+               highs.setBasis(basis) != HighsStatus::Error;
+    highs.options_.message_level = save_message_level;
+    highs.options_.logfile = save_logfile;
+    highs.options_.presolve = save_presolve;
+    highs.options_.solver = save_solver;
+  }
+#ifdef OPENMP
+#pragma omp critical(mip_tree)
+#endif
+  {
+    heuristic_simplex_iterations += iteration_count;
+    if (found && tree_.updateIncumbent(solution, objective))
+      num_diving_solutions++;
+  }
+  if (!restored)
+    printf("Failed to restore the bounds and basis of the LP after a dive\n");
+  return restored;
+}
+
+void HighsMipSolver::runSubMip(const std::vector<double>& col_lower,
+                               const std::vector<double>& col_upper) {
+  bool budget_available;
+#ifdef OPENMP
+#pragma omp critical(mip_tree)
+#endif
+  { budget_available = heuristicBudgetAvailable(); }
+  if (!budget_available) return;
+  HighsLp sub_mip = mip_;
+  sub_mip.colLower_ = col_lower;
+  sub_mip.colUpper_ = col_upper;
+  // The sub-MIP is solved silently, without heuristics or symmetry
+  // detection, on one thread and with a node limit. It mustn't
+  // overwrite the checkpoint of this search, or resume from it
+  HighsOptions sub_mip_options = options_mip_;
+  sub_mip_options.mip_checkpoint_file = "";
+  sub_mip_options.mip_resume_file = "";
+  sub_mip_options.message_level = 0;
+  sub_mip_options.mip_report_level = 0;
+  sub_mip_options.mip_max_nodes = sub_mip_max_nodes;
+  sub_mip_options.mip_heuristic_effort = 0;
+  sub_mip_options.mip_symmetry = false;
+  sub_mip_options.mip_pool_size = 0;
+  sub_mip_options.mip_threads = 1;
+  sub_mip_options.time_limit =
+      std::max(options_.time_limit - timer_.readRunHighsClock(), 0.0);
+  HighsMipSolver sub_mip_solver(sub_mip_options, sub_mip);
+  sub_mip_solver.runMipSolver();
+  // The solution is that of the sub-MIP before its own presolve, and
+  // rounding removes any small integer infeasibilities
+  const std::vector<double>& sub_mip_solution = sub_mip_solver.mip_solution_;
+  std::vector<double> solution;
+  double objective;
+  const bool found = !sub_mip_solution.empty() &&
+                     heuristics_.round(sub_mip_solution, solution, objective);
+#ifdef OPENMP
+#pragma omp critical(mip_tree)
+#endif
+  {
+    heuristic_simplex_iterations += sub_mip_solver.total_simplex_iterations;
+    if (found && tree_.updateIncumbent(solution, objective))
+      num_sub_mip_solutions++;
+  }
+}
+
+void HighsMipSolver::recordFirstIncumbentTime() {
+  if (first_incumbent_time_ < 0 && tree_.getBestObjective() < HIGHS_CONST_INF)
+    first_incumbent_time_ = timer_.readRunHighsClock();
+}
+
 HighsMipStatus HighsMipSolver::solveTree(Node& root) {
   // The method branch(...) below calls chooseBranchingVariable(..) which
   // currently returns the first violated one. If a branching variable is found
@@ -357,96 +1178,709 @@ HighsMipStatus HighsMipSolver::solveTree(Node& root) {
   // the current best is updated.
 
   tree_.setMipReportLevel(options_.mip_report_level);
+  tree_.setNodeSelection(options_.mip_node_selection,
+                         options_.mip_best_bound_frequency);
+  tree_.setBranchingRule(options_.mip_branching_rule);
+
+  if (resumed_) {
+    restoreCheckpointNodes(root);
+  } else if (tree_.branch(root, solution_.col_value, lp_.colLower_,
+                          lp_.colUpper_, -1, getBranchingPenalty(*this))) {
+    root.basis.pack(basis_);
+  }
+  recordFirstIncumbentTime();
+
+  setupWorkers(root);
+  last_checkpoint_time_ = timer_.readRunHighsClock();
+#ifdef OPENMP
+  if (workers_.size() > 1 && !options_.mip_deterministic)
+    return solveTreeAsync();
+#endif
+  return solveTreeRounds();
+}
 
-  tree_.branch(root);
+// The callback of the LPs of workers other than worker 0, which
+// passes their data to the callback of the MIP solver. The user
+// callback is then never called concurrently, and an interrupt of the
+// MIP solver - requested by the user callback or by another thread -
+// stops the LPs of every worker.
+static int workerCallback(const int callback_type,
+                          const HighsCallbackDataOut* data_out,
+                          void* user_callback_data) {
+  return ((HighsCallback*)user_callback_data)
+      ->callbackAction(callback_type, *data_out);
+}
 
-  // While stack not empty.
-  //   Solve node.
-  //   Branch.
+void HighsMipSolver::setupWorkers(Node& root) {
+  conflict_pool_.setup(mip_);
+  int num_worker = options_.mip_threads;
+#ifdef OPENMP
+  num_worker = std::min(num_worker, omp_get_max_threads());
+#else
+  num_worker = 1;
+#endif
+  workers_.clear();
+  workers_.reserve(num_worker);
+  for (int iWorker = 0; iWorker < num_worker; iWorker++) {
+    if (iWorker == 0) {
+      workers_.push_back(HighsMipWorker(*this));
+    } else {
+      // Other workers start from a copy of the LP and optimal basis
+      // of the root node
+      Highs* highs = new Highs(options_);
+      highs->passModel(lp_);
+      highs->setBasis(basis_);
+      highs->setCallback(workerCallback, &callback_);
+      workers_.push_back(HighsMipWorker(*highs));
+      workers_.back().own_highs.reset(highs);
+    }
+    HighsMipWorker& worker = workers_.back();
+    // The LP has the bounds for the root node
+    worker.lp_node = &root;
+    worker.col_set_position.assign(lp_.numCol_, -1);
+    if (options_.mip_domain_propagation) {
+      worker.domain.setup(mip_, options_.primal_feasibility_tolerance);
+      for (int iCol = 0; iCol < lp_.numCol_; iCol++)
+        worker.domain.changeBound(iCol, lp_.colLower_[iCol],
+                                  lp_.colUpper_[iCol]);
+    }
+  }
+}
+
+HighsMipStatus HighsMipSolver::solveTreeRounds() {
+  // In each round, up to one node per worker is selected and the
+  // node LPs are solved in parallel. The results are then processed
+  // in the order in which the nodes were selected, so the search is
+  // independent of the timing of the node solves. With one worker
+  // this is the serial tree search.
+  const int num_worker = workers_.size();
+  std::vector<Node*> round_node;
+  std::vector<HighsMipStatus> round_status(num_worker);
   while (!tree_.empty()) {
-    if (timer_.readRunHighsClock() > options_.time_limit)
-      return HighsMipStatus::kTimeout;
-    if (tree_.getNumNodesFormed() > options_.mip_max_nodes)
-      return HighsMipStatus::kMaxNodeReached;
-    Node& node = tree_.next();
-    double best_objective;
-    best_objective = tree_.getBestObjective();
-    if (node.parent_objective >= best_objective) {
-      // Don't solve if we can't better the best IFS
-      if (options_.mip_report_level > 1)
-        printf("Don't solve since no better than best IFS of %10.4g\n",
-               best_objective);
-      num_nodes_pruned++;
+    HighsMipStatus limit_status;
+    if (reachedTreeLimit(limit_status)) return limit_status;
+    if (checkpointDue()) writeCheckpoint();
+    round_node.clear();
+    while ((int)round_node.size() < num_worker && !tree_.empty()) {
+      Node& node = tree_.next();
       tree_.pop();
-      continue;
+      if (pruneNode(node)) continue;
+      round_node.push_back(&node);
     }
-    HighsMipStatus node_solve_status = solveNode(node);
-    num_nodes_solved++;
+    const int num_round_node = round_node.size();
+#ifdef OPENMP
+#pragma omp parallel for num_threads(num_round_node) if (num_round_node > 1)
+#endif
+    for (int iNode = 0; iNode < num_round_node; iNode++)
+      round_status[iNode] = solveNode(workers_[iNode], *round_node[iNode]);
+    for (int iNode = 0; iNode < num_round_node; iNode++) {
+      HighsMipWorker& worker = workers_[iNode];
+      HighsMipStatus node_status =
+          processNode(worker, *round_node[iNode], round_status[iNode]);
+      if (worker.heuristic_node_count >= 0)
+        node_status = runNodeHeuristics(worker);
+      if (node_status != HighsMipStatus::kNodeOptimal &&
+          node_status != HighsMipStatus::kNodeInfeasible) {
+        // The nodes of the round that haven't been processed remain
+        // to be solved
+        for (int jNode = iNode + 1; jNode < num_round_node; jNode++)
+          abandonNode(*round_node[jNode]);
+        return node_status;
+      }
+    }
+  }
+  return HighsMipStatus::kTreeExhausted;
+}
 
-    switch (node_solve_status) {
-      case HighsMipStatus::kNodeOptimal:
-        reportMipSolverProgress(node_solve_status);
-        if (options_.mip_report_level > 1) {
-          printf("Node %9d (branch on %2d) optimal objective %10.4g: ", node.id,
-                 node.branch_col, node.objective_value);
-          /*
-            std::cout << "Node " << node.id
-            << " solved to optimality." << std::endl;
-          */
+#ifdef OPENMP
+HighsMipStatus HighsMipSolver::solveTreeAsync() {
+  // Each worker repeatedly takes the next node from the shared queue,
+  // solves its LP, processes the result and, if the node is branched
+  // on, runs the heuristics from its solution. Access to the tree is
+  // serialised, but node LPs and heuristics run concurrently. The search
+  // terminates when the queue is empty and no worker has a node whose
+  // children may be added to it.
+  const int num_worker = workers_.size();
+  HighsMipStatus tree_status = HighsMipStatus::kTreeExhausted;
+  bool finished = false;
+  int num_active_worker = 0;
+#pragma omp parallel num_threads(num_worker)
+  {
+    HighsMipWorker& worker = workers_[omp_get_thread_num()];
+    for (;;) {
+      Node* node = nullptr;
+      bool worker_finished = false;
+#pragma omp critical(mip_tree)
+      {
+        HighsMipStatus limit_status;
+        if (!finished && reachedTreeLimit(limit_status)) {
+          tree_status = limit_status;
+          finished = true;
         }
-        tree_.pop();
-        // Don't branch if we can't better the best IFS
-        double best_objective;
-        best_objective = tree_.getBestObjective();
-        if (node.objective_value >= best_objective) {
-          if (options_.mip_report_level > 1)
-            printf("Don't branch since no better than best IFS of %10.4g\n",
-                   best_objective);
+        if (!finished && checkpointDue()) writeCheckpoint();
+        while (!finished && !tree_.empty()) {
+          Node& next_node = tree_.next();
+          tree_.pop();
+          if (pruneNode(next_node)) continue;
+          node = &next_node;
+          worker.active_node = node;
+          num_active_worker++;
           break;
         }
-        tree_.branch(node);
-        break;
-      case HighsMipStatus::kNodeInfeasible:
-        reportMipSolverProgress(node_solve_status);
-        if (options_.mip_report_level > 1) {
-          printf("Node %9d (branch on %2d) infeasible\n", node.id,
-                 node.branch_col);
-          /*
-            std::cout << "Node " << node.id
-            << " infeasible." << std::endl;
-          */
+        if (node == nullptr && num_active_worker == 0) finished = true;
+        worker_finished = finished;
+      }
+      if (worker_finished) break;
+      if (node == nullptr) {
+        // Wait for another worker to add nodes to the queue
+        std::this_thread::yield();
+        continue;
+      }
+      HighsMipStatus node_solve_status = solveNode(worker, *node);
+#pragma omp critical(mip_tree)
+      {
+        num_active_worker--;
+        worker.active_node = nullptr;
+        HighsMipStatus node_status =
+            processNode(worker, *node, node_solve_status);
+        if (!finished && node_status != HighsMipStatus::kNodeOptimal &&
+            node_status != HighsMipStatus::kNodeInfeasible) {
+          tree_status = node_status;
+          finished = true;
+        }
+      }
+      if (worker.heuristic_node_count >= 0 &&
+          runNodeHeuristics(worker) == HighsMipStatus::kNodeError) {
+#pragma omp critical(mip_tree)
+        {
+          if (!finished) {
+            tree_status = HighsMipStatus::kNodeError;
+            finished = true;
+          }
         }
-        tree_.pop();
+      }
+    }
+  }
+  return tree_status;
+}
+#endif
+
+void HighsMipSolver::branchingPenalty(Highs& highs, const int col,
+                                      const double value,
+                                      double& down_penalty,
+                                      double& up_penalty) {
+  // The penalties come from the INVERT of the LP just solved, so are
+  // zero if it's not available
+  down_penalty = 0;
+  up_penalty = 0;
+  if (highs.hmos_.size() != 1) return;
+  HighsSimplexInterface interface(highs.hmos_[0]);
+  interface.branchingPenalty(col, value, down_penalty, up_penalty);
+}
+
+Tree::BranchingPenalty HighsMipSolver::getBranchingPenalty(Highs& highs) {
+  if (!options_.mip_branching_penalty) return nullptr;
+  return [this, &highs](const int col, const double value,
+                        double& down_penalty, double& up_penalty) {
+    branchingPenalty(highs, col, value, down_penalty, up_penalty);
+  };
+}
+
+void HighsMipSolver::strongBranch(HighsMipWorker& worker, const Node& node) {
+  // Estimate the objective gain when branching down and up on
+  // fractional columns with unreliable pseudocosts by performing a
+  // limited number of dual simplex iterations on each child LP. The
+  // trials start from the node's optimal basis and INVERT, and the
+  // basis is restored after each one, so INVERT is only recomputed
+  // after a trial that changes the basis.
+  Highs& highs = worker.highs;
+  const std::vector<double>& value = worker.primal_solution;
+  const std::vector<double>& col_lower = highs.lp_.colLower_;
+  const std::vector<double>& col_upper = highs.lp_.colUpper_;
+  const double fractional_tolerance = 1e-7;
+  if (highs.hmos_.size() != 1) return;
+
+  // Identify the candidates, most fractional first
+  std::vector<std::pair<double, int> > candidate;
+#ifdef OPENMP
+#pragma omp critical(mip_tree)
+#endif
+  {
+    for (int iCol = 0; iCol < mip_.numCol_; iCol++) {
+      if (!mip_.integrality_[iCol]) continue;
+      if (value[iCol] <= col_lower[iCol] + fractional_tolerance ||
+          value[iCol] >= col_upper[iCol] - fractional_tolerance)
+        continue;
+      const double fraction = value[iCol] - std::floor(value[iCol]);
+      if (fraction <= fractional_tolerance ||
+          fraction >= 1 - fractional_tolerance)
+        continue;
+      if (tree_.getNumPseudocostObservation(iCol) >= reliability_threshold)
+        continue;
+      candidate.push_back(
+          std::make_pair(-std::min(fraction, 1 - fraction), iCol));
+    }
+  }
+  if (candidate.empty()) return;
+  std::sort(candidate.begin(), candidate.end());
+  if ((int)candidate.size() > strong_branching_max_candidates)
+    candidate.resize(strong_branching_max_candidates);
+
+  const int num_candidate = candidate.size();
+  std::vector<int> candidate_col(num_candidate);
+  std::vector<double> candidate_value(num_candidate);
+  for (int ix = 0; ix < num_candidate; ix++) {
+    candidate_col[ix] = candidate[ix].second;
+    candidate_value[ix] = value[candidate[ix].second];
+  }
+  std::vector<HighsModelStatus> down_status(num_candidate);
+  std::vector<HighsModelStatus> up_status(num_candidate);
+  std::vector<double> down_objective(num_candidate);
+  std::vector<double> up_objective(num_candidate);
+  int iteration_count;
+  HighsSimplexInterface interface(highs.hmos_[0]);
+  HighsStatus call_status = interface.strongBranch(
+      num_candidate, &candidate_col[0], &candidate_value[0],
+      strong_branching_iteration_limit, &down_status[0], &down_objective[0],
+      &up_status[0], &up_objective[0], iteration_count);
+  if (call_status == HighsStatus::Error) return;
+  worker.strong_branching_iterations += iteration_count;
+
+  for (int ix = 0; ix < num_candidate; ix++) {
+    const int iCol = candidate_col[ix];
+    for (const bool up : {false, true}) {
+      const HighsModelStatus status = up ? up_status[ix] : down_status[ix];
+      if (status == HighsModelStatus::NOTSET) continue;
+      worker.num_strong_branching_lp++;
+      if (status == HighsModelStatus::PRIMAL_INFEASIBLE ||
+          status ==
+              HighsModelStatus::REACHED_DUAL_OBJECTIVE_VALUE_UPPER_BOUND) {
+        // Branching on this column prunes one child immediately
+        if (worker.strong_branching_preferred_col < 0)
+          worker.strong_branching_preferred_col = iCol;
+      } else if (status == HighsModelStatus::OPTIMAL ||
+                 status == HighsModelStatus::REACHED_ITERATION_LIMIT) {
+        const double fraction = up ? std::ceil(value[iCol]) - value[iCol]
+                                   : value[iCol] - std::floor(value[iCol]);
+        const double objective = up ? up_objective[ix] : down_objective[ix];
+        const double gain = std::max(objective - node.objective_value, 0.0);
+        worker.strong_branching_gain.push_back({iCol, up, gain / fraction});
+      }
+    }
+  }
+}
+
+void HighsMipSolver::analyzeConflict(HighsMipWorker& worker,
+                                     const double cutoff) {
+  // The conflict is derived from the dual ray of the node LP if it's
+  // infeasible, and from its row duals if it's been cut off. It's
+  // added to the pool when the node is processed
+  Highs& highs = worker.highs;
+  if (highs.hmos_.size() != 1 || highs.lp_.numRow_ == 0) return;
+  const double conflict_start_time = timer_.getWallTime();
+  if (highs_isInfinity(cutoff)) {
+    bool has_dual_ray = false;
+    worker.dual_ray.resize(highs.lp_.numRow_);
+    if (highs.getDualRay(has_dual_ray, &worker.dual_ray[0]) !=
+            HighsStatus::Error &&
+        has_dual_ray)
+      conflict_pool_.analyzeDualRay(highs.lp_, worker.dual_ray,
+                                    worker.conflict);
+  } else {
+    // The HiGHS solution is cleared when the LP is cut off, but that
+    // of the model object isn't
+    const std::vector<double>& row_dual = highs.hmos_[0].solution_.row_dual;
+    if ((int)row_dual.size() == highs.lp_.numRow_)
+      conflict_pool_.analyzeCutoff(highs.lp_, row_dual, cutoff,
+                                   worker.conflict);
+  }
+  worker.conflict_time += timer_.getWallTime() - conflict_start_time;
+}
+
+int HighsMipSolver::reducedCostFixing(Highs& highs, Node& node,
+                                      HighsDomain* domain,
+                                      std::vector<int>& set,
+                                      std::vector<double>& lower,
+                                      std::vector<double>& upper) {
+  // Moving a nonbasic column away from its bound by t increases the
+  // objective by at least t times its reduced cost, so the bounds on
+  // integer columns can be tightened so that the objective can't
+  // exceed that of the incumbent. Since the columns are nonbasic at
+  // the bound that's not changed, the LP solution remains optimal.
+  // The tightened bounds are recorded as implied by the node.
+  const double best_objective = tree_.getBestObjective();
+  if (best_objective >= HIGHS_CONST_INF) return 0;
+  const double gap = best_objective - node.objective_value;
+  if (gap < 0) return 0;
+  const HighsLp& lp = highs.lp_;
+  const std::vector<double>& col_dual = highs.solution_.col_dual;
+  const std::vector<HighsBasisStatus>& col_status = highs.basis_.col_status;
+  const double dual_feasibility_tolerance =
+      highs.options_.dual_feasibility_tolerance;
+  set.clear();
+  lower.clear();
+  upper.clear();
+  for (int iCol = 0; iCol < mip_.numCol_; iCol++) {
+    if (!mip_.integrality_[iCol]) continue;
+    const double col_lower = lp.colLower_[iCol];
+    const double col_upper = lp.colUpper_[iCol];
+    if (col_lower == col_upper) continue;
+    const double dual = col_dual[iCol];
+    if (col_status[iCol] == HighsBasisStatus::LOWER &&
+        dual > dual_feasibility_tolerance) {
+      const double new_upper =
+          col_lower + std::floor(gap / dual + reduced_cost_fixing_tolerance);
+      if (new_upper >= col_upper) continue;
+      set.push_back(iCol);
+      lower.push_back(col_lower);
+      upper.push_back(new_upper);
+    } else if (col_status[iCol] == HighsBasisStatus::UPPER &&
+               dual < -dual_feasibility_tolerance) {
+      const double new_lower =
+          col_upper - std::floor(gap / -dual + reduced_cost_fixing_tolerance);
+      if (new_lower <= col_lower) continue;
+      set.push_back(iCol);
+      lower.push_back(new_lower);
+      upper.push_back(col_upper);
+    }
+  }
+  const int num_fixed = set.size();
+  if (!num_fixed) return 0;
+  highs.changeColsBounds(num_fixed, &set[0], &lower[0], &upper[0]);
+  for (int ix = 0; ix < num_fixed; ix++) {
+    if (domain) domain->changeBound(set[ix], lower[ix], upper[ix]);
+    node.implied_col.push_back(set[ix]);
+    node.implied_col_lower.push_back(lower[ix]);
+    node.implied_col_upper.push_back(upper[ix]);
+  }
+  return num_fixed;
+}
+
+bool HighsMipSolver::resumeFromCheckpoint() {
+  // The checkpoint must be for the MIP after MIP presolve, with the
+  // same root bounds, otherwise the search starts afresh
+  HighsMipCheckpoint& checkpoint = resume_checkpoint_;
+  if (!checkpoint.read(options_.mip_resume_file)) {
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL,
+                      "Unable to read MIP checkpoint file %s, so the search "
+                      "starts afresh\n",
+                      options_.mip_resume_file.c_str());
+    return false;
+  }
+  const int num_col = mip_.numCol_;
+  if (checkpoint.mip_hash != HighsMipCheckpoint::hashMip(mip_) ||
+      (int)checkpoint.root_col_lower.size() != num_col ||
+      (int)checkpoint.root_col_upper.size() != num_col ||
+      checkpoint.pseudocost.numCol() != num_col ||
+      (!checkpoint.best_solution.empty() &&
+       (int)checkpoint.best_solution.size() != num_col)) {
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL,
+                      "MIP checkpoint file %s is not for this MIP, so the "
+                      "search starts afresh\n",
+                      options_.mip_resume_file.c_str());
+    resume_checkpoint_ = HighsMipCheckpoint();
+    return false;
+  }
+  if (!checkpoint.best_solution.empty())
+    tree_.updateIncumbent(checkpoint.best_solution, checkpoint.best_objective);
+  tree_.getPseudocost() = checkpoint.pseudocost;
+  tree_.restoreCounts(checkpoint.num_nodes_formed,
+                      checkpoint.num_integer_solutions,
+                      checkpoint.node.size());
+  num_nodes_solved = checkpoint.num_nodes_solved;
+  num_nodes_pruned = checkpoint.num_nodes_pruned;
+  total_simplex_iterations += checkpoint.total_simplex_iterations;
+  HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                    ML_MINIMAL,
+                    "Resuming the MIP search from %s with %d open nodes\n",
+                    options_.mip_resume_file.c_str(),
+                    (int)checkpoint.node.size());
+  return true;
+}
+
+void HighsMipSolver::restoreCheckpointNodes(Node& root) {
+  const HighsMipCheckpoint& checkpoint = resume_checkpoint_;
+  // The bases are only of use if the root cut loop has given an LP
+  // with the same rows
+  const bool use_basis = checkpoint.lp_num_row == lp_.numRow_;
+  const std::vector<double>& root_col_lower = tree_.getRootColLower();
+  const std::vector<double>& root_col_upper = tree_.getRootColUpper();
+  std::vector<double> col_lower;
+  std::vector<double> col_upper;
+  HighsCheckpointNode node;
+  for (const HighsCheckpointNode& checkpoint_node : checkpoint.node) {
+    // Form the node's bounds from the root bounds of the checkpoint,
+    // and restore those that differ from the current root bounds
+    col_lower = checkpoint.root_col_lower;
+    col_upper = checkpoint.root_col_upper;
+    for (int ix = 0; ix < (int)checkpoint_node.col.size(); ix++) {
+      col_lower[checkpoint_node.col[ix]] = checkpoint_node.col_lower[ix];
+      col_upper[checkpoint_node.col[ix]] = checkpoint_node.col_upper[ix];
+    }
+    node = checkpoint_node;
+    node.col.clear();
+    node.col_lower.clear();
+    node.col_upper.clear();
+    for (int iCol = 0; iCol < lp_.numCol_; iCol++) {
+      if (col_lower[iCol] == root_col_lower[iCol] &&
+          col_upper[iCol] == root_col_upper[iCol])
+        continue;
+      node.col.push_back(iCol);
+      node.col_lower.push_back(col_lower[iCol]);
+      node.col_upper.push_back(col_upper[iCol]);
+    }
+    const HighsPackedBasis* basis =
+        use_basis && checkpoint_node.basis >= 0
+            ? &checkpoint.basis[checkpoint_node.basis]
+            : nullptr;
+    tree_.restoreNode(root, node, basis);
+  }
+  resume_checkpoint_ = HighsMipCheckpoint();
+}
+
+bool HighsMipSolver::checkpointDue() {
+  return !options_.mip_checkpoint_file.empty() &&
+         timer_.readRunHighsClock() - last_checkpoint_time_ >=
+             options_.mip_checkpoint_interval;
+}
+
+void HighsMipSolver::writeCheckpoint() {
+  HighsMipCheckpoint checkpoint;
+  checkpoint.mip_hash = HighsMipCheckpoint::hashMip(mip_);
+  checkpoint.root_col_lower = tree_.getRootColLower();
+  checkpoint.root_col_upper = tree_.getRootColUpper();
+  checkpoint.best_objective = tree_.getBestObjective();
+  checkpoint.best_solution = tree_.getBestSolution();
+  checkpoint.pseudocost = tree_.getPseudocost();
+  checkpoint.lp_num_row = lp_.numRow_;
+
+  // The open nodes are those in the queue, those being solved, and
+  // those whose LPs weren't solved when the search stopped
+  std::vector<Node*> open_node;
+  tree_.getOpenNodes(open_node);
+  for (const HighsMipWorker& worker : workers_)
+    if (worker.active_node != nullptr) open_node.push_back(worker.active_node);
+  open_node.insert(open_node.end(), unfinished_node_.begin(),
+                   unfinished_node_.end());
+  std::map<const Node*, int> basis_index;
+  std::vector<double> col_lower;
+  std::vector<double> col_upper;
+  const std::vector<double>& root_col_lower = tree_.getRootColLower();
+  const std::vector<double>& root_col_upper = tree_.getRootColUpper();
+  for (const Node* node : open_node) {
+    // The bounds implied at a node may be changing if it's being
+    // solved, so its bounds are formed from those of its parent and
+    // its branching bound changes
+    const Node* parent = node->parent;
+    assert(parent != nullptr);
+    tree_.getNodeBounds(*parent, col_lower, col_upper);
+    col_lower[node->branch_col] = node->branch_col_lower;
+    col_upper[node->branch_col] = node->branch_col_upper;
+    for (int orbit_col : node->orbit_col) {
+      col_lower[orbit_col] = node->branch_col_lower;
+      col_upper[orbit_col] = node->branch_col_upper;
+    }
+    HighsCheckpointNode checkpoint_node;
+    checkpoint_node.parent_objective = node->parent_objective;
+    checkpoint_node.estimate = node->estimate;
+    checkpoint_node.branch_col = node->branch_col;
+    checkpoint_node.branch_col_lower = node->branch_col_lower;
+    checkpoint_node.branch_col_upper = node->branch_col_upper;
+    checkpoint_node.branch_fraction = node->branch_fraction;
+    checkpoint_node.branch_up = node->branch_up;
+    for (int iCol = 0; iCol < lp_.numCol_; iCol++) {
+      if (col_lower[iCol] == root_col_lower[iCol] &&
+          col_upper[iCol] == root_col_upper[iCol])
+        continue;
+      checkpoint_node.col.push_back(iCol);
+      checkpoint_node.col_lower.push_back(col_lower[iCol]);
+      checkpoint_node.col_upper.push_back(col_upper[iCol]);
+    }
+    // Siblings share their parent's basis
+    checkpoint_node.basis = -1;
+    if (!parent->basis.empty()) {
+      auto inserted =
+          basis_index.insert(std::make_pair(parent, checkpoint.basis.size()));
+      if (inserted.second) checkpoint.basis.push_back(parent->basis);
+      checkpoint_node.basis = inserted.first->second;
+    }
+    checkpoint.node.push_back(std::move(checkpoint_node));
+  }
+  checkpoint.num_nodes_formed = tree_.getNumNodesFormed();
+  checkpoint.num_nodes_solved = num_nodes_solved;
+  checkpoint.num_nodes_pruned = num_nodes_pruned;
+  checkpoint.num_integer_solutions = tree_.getNumIntegerSolutions();
+  checkpoint.total_simplex_iterations = total_simplex_iterations;
+  if (checkpoint.write(options_.mip_checkpoint_file)) {
+    num_checkpoints_++;
+  } else {
+    HighsPrintMessage(options_mip_.output, options_mip_.message_level,
+                      ML_MINIMAL, "Unable to write MIP checkpoint file %s\n",
+                      options_.mip_checkpoint_file.c_str());
+  }
+  last_checkpoint_time_ = timer_.readRunHighsClock();
+}
+
+bool HighsMipSolver::reachedTreeLimit(HighsMipStatus& mip_status) {
+  if (timer_.readRunHighsClock() > options_.time_limit) {
+    mip_status = HighsMipStatus::kTimeout;
+    return true;
+  }
+  if (callback_.interruptRequested()) {
+    // Interrupt requested between node solves, so honour it here
+    callback_.clearInterrupt();
+    mip_status = HighsMipStatus::kInterrupted;
+    return true;
+  }
+  if (tree_.getNumNodesFormed() > options_.mip_max_nodes) {
+    mip_status = HighsMipStatus::kMaxNodeReached;
+    return true;
+  }
+  return false;
+}
+
+bool HighsMipSolver::pruneNode(Node& node) {
+  double best_objective = tree_.getBestObjective();
+  if (node.lower_bound < best_objective) return false;
+  if (node.parent_objective < best_objective) num_nodes_penalty_pruned++;
+  tree_.closeNode(node);
+  // Don't solve if we can't better the best IFS
+  if (options_.mip_report_level > 1)
+    printf("Don't solve since no better than best IFS of %10.4g\n",
+           best_objective);
+  num_nodes_pruned++;
+  return true;
+}
+
+void HighsMipSolver::abandonNode(Node& node) {
+  // The node isn't solved, and remains open so that its parent keeps
+  // the basis from which it's solved if the search is resumed
+  unfinished_node_.push_back(&node);
+}
+
+HighsMipStatus HighsMipSolver::processNode(
+    HighsMipWorker& worker, Node& node,
+    const HighsMipStatus node_solve_status) {
+  Highs& highs = worker.highs;
+  if (node_solve_status == HighsMipStatus::kTimeout ||
+      node_solve_status == HighsMipStatus::kReachedSimplexIterationLimit ||
+      node_solve_status == HighsMipStatus::kInterrupted) {
+    // The node's LP wasn't solved
+    abandonNode(node);
+  } else {
+    tree_.closeNode(node);
+    num_nodes_solved++;
+  }
+  total_simplex_iterations += worker.node_simplex_iterations;
+  num_strong_branching_lp += worker.num_strong_branching_lp;
+  total_strong_branching_iterations += worker.strong_branching_iterations;
+  if (worker.propagation_infeasible) num_nodes_propagation_pruned++;
+  if (worker.conflict_pruned) num_nodes_conflict_pruned++;
+  if (!worker.conflict.empty() && conflict_pool_.addConflict(worker.conflict))
+    num_conflicts++;
+  conflict_time += worker.conflict_time;
+  if (worker.lp_cutoff) {
+    num_nodes_lp_cutoff++;
+    node_lp_cutoff_iterations += worker.node_simplex_iterations;
+  } else if (node_solve_status == HighsMipStatus::kNodeOptimal) {
+    num_nodes_lp_optimal++;
+    node_lp_optimal_iterations += worker.node_simplex_iterations;
+  }
+  num_reduced_cost_fixed += worker.num_reduced_cost_fixed;
+  total_propagation_time += worker.propagation_time;
+  if (callback_.active()) mipNodeCallback(highs);
+
+  switch (node_solve_status) {
+    case HighsMipStatus::kNodeOptimal:
+      reportMipSolverProgress(node_solve_status);
+      if (options_.mip_report_level > 1) {
+        printf("Node %9d (branch on %2d) optimal objective %10.4g: ", node.id,
+               node.branch_col, node.objective_value);
+        /*
+          std::cout << "Node " << node.id
+          << " solved to optimality." << std::endl;
+        */
+      }
+      tree_.updatePseudocost(node);
+      for (const HighsMipWorker::StrongBranchingGain& gain :
+           worker.strong_branching_gain)
+        tree_.addStrongBranchingGain(gain.col, gain.up, gain.unit_gain);
+      // Don't branch if we can't better the best IFS
+      double best_objective;
+      best_objective = tree_.getBestObjective();
+      if (node.objective_value >= best_objective) {
+        if (options_.mip_report_level > 1)
+          printf("Don't branch since no better than best IFS of %10.4g\n",
+                 best_objective);
         break;
-      case HighsMipStatus::kTimeout:
-        return HighsMipStatus::kTimeout;
-      case HighsMipStatus::kReachedSimplexIterationLimit:
-        return HighsMipStatus::kReachedSimplexIterationLimit;
-      case HighsMipStatus::kNodeUnbounded:
-        return HighsMipStatus::kNodeUnbounded;
-      default:
+      }
+      if (tree_.branch(node, worker.primal_solution, highs.lp_.colLower_,
+                       highs.lp_.colUpper_,
+                       worker.strong_branching_preferred_col,
+                       getBranchingPenalty(highs))) {
+        node.basis.pack(highs.basis_);
+        worker.heuristic_node_count = num_nodes_solved;
+      }
+      recordFirstIncumbentTime();
+      break;
+    case HighsMipStatus::kNodeInfeasible:
+      reportMipSolverProgress(node_solve_status);
+      if (options_.mip_report_level > 1) {
+        printf("Node %9d (branch on %2d) infeasible\n", node.id,
+               node.branch_col);
         /*
-          std::cout << "Error or warning: Node " << node.id
-          << " not solved to optimality, infeasibility or unboundedness." <<
-          std::endl;
+          std::cout << "Node " << node.id
+          << " infeasible." << std::endl;
         */
-        printf(
-            "Node %9d (branch on %2d) not solved to optimality, infeasibility "
-            "or unboundedness: status = %s\n",
-            node.id, node.branch_col,
-            highsMipStatusToString(node_solve_status).c_str());
-        printf(
-            "  Scaled model status is %s: max unscaled ( primal / dual ) "
-            "infeasibilities are ( %g / %g )\n",
-            highsModelStatusToString(scaled_model_status_).c_str(),
-            info_.max_primal_infeasibility, info_.max_dual_infeasibility);
-        printf("Unscaled model status is %s\n",
-               highsModelStatusToString(model_status_).c_str());
-        // Was break; but this causes infinite loop
-        return HighsMipStatus::kNodeError;
-    }
+      }
+      break;
+    case HighsMipStatus::kTimeout:
+    case HighsMipStatus::kReachedSimplexIterationLimit:
+    case HighsMipStatus::kInterrupted:
+      break;
+    case HighsMipStatus::kNodeUnbounded:
+      break;
+    default:
+      /*
+        std::cout << "Error or warning: Node " << node.id
+        << " not solved to optimality, infeasibility or unboundedness." <<
+        std::endl;
+      */
+      printf(
+          "Node %9d (branch on %2d) not solved to optimality, infeasibility "
+          "or unboundedness: status = %s\n",
+          node.id, node.branch_col,
+          highsMipStatusToString(node_solve_status).c_str());
+      printf(
+          "  Scaled model status is %s: max unscaled ( primal / dual ) "
+          "infeasibilities are ( %g / %g )\n",
+          highsModelStatusToString(highs.scaled_model_status_).c_str(),
+          highs.info_.max_primal_infeasibility,
+          highs.info_.max_dual_infeasibility);
+      printf("Unscaled model status is %s\n",
+             highsModelStatusToString(highs.model_status_).c_str());
+      // Was break; but this causes infinite loop
+      return HighsMipStatus::kNodeError;
   }
-  return HighsMipStatus::kTreeExhausted;
+  return node_solve_status;
+}
+
+void HighsMipSolver::mipNodeCallback(const Highs& highs) {
+  HighsCallbackDataOut data_out;
+  HighsCallback::clearDataOut(data_out);
+  data_out.running_time = timer_.readRunHighsClock();
+  data_out.simplex_iteration_count = total_simplex_iterations;
+  data_out.objective_function_value = highs.info_.objective_function_value;
+  data_out.mip_node_count = num_nodes_solved;
+  data_out.mip_primal_bound = tree_.getBestObjective();
+  int best_node;
+  data_out.mip_dual_bound = tree_.getNumNodesLeft() > 0
+                                ? tree_.getBestBound(best_node)
+                                : data_out.mip_primal_bound;
+  // Any interrupt is picked up before the next node is solved
+  callback_.callbackAction(HIGHS_CALLBACK_MIP_NODE_SOLVED, data_out);
 }
 
 void HighsMipSolver::reportMipSolverProgress(const HighsMipStatus mip_status) {
@@ -509,6 +1943,9 @@ void HighsMipSolver::reportMipSolverProgress(const HighsMipStatus mip_status) {
       case HighsMipStatus::kTreeExhausted:
         reportMipSolverProgressLine("Tree exhausted");
         break;
+      case HighsMipStatus::kInterrupted:
+        reportMipSolverProgressLine("Interrupted");
+        break;
       default:
         reportMipSolverProgressLine("Unknown");
         break;
@@ -527,7 +1964,7 @@ void HighsMipSolver::reportMipSolverProgressLine(std::string message,
         " primalbound |    gap \n");
   } else {
     double average_simplex_iterations =
-        total_simplex_iterations / num_nodes_solved;
+        (double)total_simplex_iterations / num_nodes_solved;
     double time = timer_.readRunHighsClock();
     int num_nodes_left = tree_.getNumNodesLeft();
     double best_bound;
@@ -564,6 +2001,22 @@ void HighsMipSolver::reportMipSolverProgressLine(std::string message,
   }
 }
 
+std::string HighsMipSolver::mipBranchingRuleToString(
+    const int branching_rule) {
+  switch (branching_rule) {
+    case MIP_BRANCHING_RULE_FIRST_FRACTIONAL:
+      return "First fractional";
+    case MIP_BRANCHING_RULE_MOST_FRACTIONAL:
+      return "Most fractional";
+    case MIP_BRANCHING_RULE_PSEUDOCOST:
+      return "Pseudocost";
+    case MIP_BRANCHING_RULE_RELIABILITY:
+      return "Reliability";
+    default:
+      return "Unrecognised branching rule";
+  }
+}
+
 std::string HighsMipSolver::highsMipStatusToString(
     const HighsMipStatus mip_status) {
   switch (mip_status) {
@@ -609,6 +2062,9 @@ std::string HighsMipSolver::highsMipStatusToString(
     case HighsMipStatus::kTreeExhausted:
       return "Tree exhausted";
       break;
+    case HighsMipStatus::kInterrupted:
+      return "Interrupted";
+      break;
     default:
 #ifdef HiGHSDEV
       printf("HiGHS MIP status %d not recognised\n", (int)mip_status);
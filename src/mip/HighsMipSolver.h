@@ -12,6 +12,13 @@
 
 #include "Highs.h"
 #include "lp_data/HighsOptions.h"
+#include "mip/HighsConflictPool.h"
+#include "mip/HighsCutPool.h"
+#include "mip/HighsDomain.h"
+#include "mip/HighsMipPresolve.h"
+#include "mip/HighsPrimalHeuristics.h"
+#include "mip/HighsSeparation.h"
+#include "mip/HighsSymmetry.h"
 #include "mip/SolveMip.h"
 
 enum class HighsMipStatus {
@@ -29,39 +36,249 @@ enum class HighsMipStatus {
   kRootNodeError,
   kMaxNodeReached,
   kUnderDevelopment,
-  kTreeExhausted
+  kTreeExhausted,
+  kInterrupted
 };
 
+// The data needed to solve node LPs on one thread. Each worker has
+// its own Highs instance with a copy of the LP relaxation - that of
+// worker 0 is the HighsMipSolver itself - and records the node whose
+// bounds are in its LP.
+struct HighsMipWorker {
+  HighsMipWorker(Highs& highs_) : highs(highs_) {}
+  Highs& highs;
+  std::unique_ptr<Highs> own_highs;
+  Node* lp_node = nullptr;
+  int node_simplex_iterations = 0;
+  // The primal solution of the node LP last solved
+  std::vector<double> primal_solution;
+  // Strong branching results for the node LP last solved
+  struct StrongBranchingGain {
+    int col;
+    bool up;
+    double unit_gain;
+  };
+  std::vector<StrongBranchingGain> strong_branching_gain;
+  int strong_branching_preferred_col = -1;
+  int num_strong_branching_lp = 0;
+  int strong_branching_iterations = 0;
+  // The column bounds of the LP, with the row activities that they
+  // imply, used for domain propagation
+  HighsDomain domain;
+  bool propagation_infeasible = false;
+  double propagation_time = 0;
+  // The conflict derived from the node LP if it was infeasible or cut
+  // off, the number of conflicts in the pool that have been added to
+  // the domain, and whether a conflict made the node infeasible
+  std::vector<HighsConflictLiteral> conflict;
+  std::vector<double> dual_ray;
+  int num_conflict_synced = 0;
+  bool conflict_pruned = false;
+  double conflict_time = 0;
+  // Whether dual simplex abandoned the node LP since its objective
+  // reached that of the incumbent
+  bool lp_cutoff = false;
+  int num_reduced_cost_fixed = 0;
+  // If the node LP last solved was branched on, the number of nodes
+  // solved at that point, so the heuristics are run from its solution,
+  // and -1 otherwise
+  int heuristic_node_count = -1;
+  // Workspace for Tree::getBoundChange
+  std::vector<int> bound_change_set;
+  std::vector<double> bound_change_lower;
+  std::vector<double> bound_change_upper;
+  std::vector<int> col_set_position;
+  HighsBasis basis;
+  // The node whose LP is being solved, which isn't in the tree's queue
+  Node* active_node = nullptr;
+};
+
+// Reliability branching uses strong branching on at most
+// strong_branching_max_candidates fractional columns with fewer than
+// reliability_threshold pseudocost observations, each limited to
+// strong_branching_iteration_limit dual simplex iterations
+const int reliability_threshold = 4;
+const int strong_branching_max_candidates = 10;
+const int strong_branching_iteration_limit = 25;
+
+// Each round of the root cut loop adds at most root_cut_max_num_per_round
+// cuts from the pool to the LP. Cuts that have been basic in the LP
+// for root_cut_row_age_limit rounds are removed, and the loop stops
+// after root_cut_max_stall_rounds rounds in which the objective
+// improves by less than root_cut_min_improvement (relative)
+const int root_cut_max_num_per_round = 50;
+const int root_cut_row_age_limit = 3;
+const int root_cut_max_stall_rounds = 3;
+const double root_cut_min_improvement = 1e-4;
+
+// Heuristics other than rounding may use mip_heuristic_effort times
+// the simplex iterations of the search plus heuristic_min_iterations.
+// In the tree, a dive or sub-MIP is attempted every
+// heuristic_node_frequency nodes. Sub-MIPs are limited to
+// sub_mip_max_nodes nodes, and are only solved if at least
+// sub_mip_min_fixing_rate of the integer columns are fixed.
+const int heuristic_min_iterations = 1000;
+const int heuristic_node_frequency = 10;
+const int sub_mip_max_nodes = 500;
+const double sub_mip_min_fixing_rate = 0.5;
+
+// Reduced cost fixing allows a column to move floor(gap / |dual| +
+// reduced_cost_fixing_tolerance) from its bound, where gap is the
+// difference between the incumbent and node objective values
+const double reduced_cost_fixing_tolerance = 1e-6;
+
 const double unscaled_primal_feasibility_tolerance = 1e-4;
 const double unscaled_dual_feasibility_tolerance = 1e-4;
 
 class HighsMipSolver : Highs {
  public:
   HighsMipSolver(const HighsOptions& options, const HighsLp& lp)
-      : options_mip_(options), mip_(lp) {}
+      : options_mip_(options), original_mip_(lp), mip_(lp) {}
 
   HighsMipStatus runMipSolver();
+  // The objective value of the best integer solution found, or +inf
+  // if there is none
+  double getBestObjective() { return tree_.getBestObjective(); }
+  // The best integer solution of the original MIP, or empty if there
+  // is none
+  const std::vector<double>& getBestSolution() const { return mip_solution_; }
+  // The number of nodes solved, and the best bound on the optimal
+  // objective value, which is -inf unless the root node is solved
+  int getNumNodesSolved() const { return num_nodes_solved; }
+  double getDualBound() const { return dual_bound_; }
+  // The model status of the MIP corresponding to the status returned
+  // by runMipSolver
+  HighsModelStatus getMipModelStatus(const HighsMipStatus mip_status) const;
+  // The distinct integer feasible solutions of the original MIP in
+  // the solution pool, best first
+  using Highs::getMipSolution;
+  using Highs::getNumMipSolutions;
+
+  // Callbacks are made after each node solve, as well as from within
+  // the node LP solves
+  using Highs::requestInterrupt;
+  using Highs::setCallback;
 
  private:
 #ifdef HiGHSDEV
-  void writeSolutionForIntegerVariables(Node& node);
+  void writeSolutionForIntegerVariables();
 #endif
   HighsMipStatus solveRootNode();
-  HighsMipStatus solveNode(Node& node, bool hotstart = true);
+  HighsMipStatus solveRootNodeConcurrent();
+  HighsMipStatus solveRootCutLoop();
+  bool presolveMip();
+  void postsolveMipSolution();
+  void runRootHeuristics();
+  HighsMipStatus runNodeHeuristics(HighsMipWorker& worker);
+  bool heuristicBudgetAvailable() const;
+  bool runDive(const HighsDiveRule rule, const std::vector<double>& col_lower,
+               const std::vector<double>& col_upper,
+               const std::vector<double>& lp_solution,
+               HighsMipWorker* worker = nullptr);
+  void runSubMip(const std::vector<double>& col_lower,
+                 const std::vector<double>& col_upper);
+  void recordFirstIncumbentTime();
+  HighsMipStatus solveNode(HighsMipWorker& worker, Node& node,
+                           bool hotstart = true);
   HighsMipStatus solveTree(Node& root);
+  void setupWorkers(Node& root);
+  HighsMipStatus solveTreeRounds();
+  HighsMipStatus solveTreeAsync();
+  void strongBranch(HighsMipWorker& worker, const Node& node);
+  void analyzeConflict(HighsMipWorker& worker, const double cutoff);
+  void branchingPenalty(Highs& highs, const int col, const double value,
+                        double& down_penalty, double& up_penalty);
+  Tree::BranchingPenalty getBranchingPenalty(Highs& highs);
+  bool resumeFromCheckpoint();
+  void restoreCheckpointNodes(Node& root);
+  bool checkpointDue();
+  void writeCheckpoint();
+  int reducedCostFixing(Highs& highs, Node& node, HighsDomain* domain,
+                        std::vector<int>& set, std::vector<double>& lower,
+                        std::vector<double>& upper);
+  bool reachedTreeLimit(HighsMipStatus& mip_status);
+  bool pruneNode(Node& node);
+  void abandonNode(Node& node);
+  HighsMipStatus processNode(HighsMipWorker& worker, Node& node,
+                             const HighsMipStatus node_solve_status);
   void reportMipSolverProgress(const HighsMipStatus mip_status);
+  void mipNodeCallback(const Highs& highs);
   void reportMipSolverProgressLine(std::string message,
                                    const bool header = false);
   std::string highsMipStatusToString(const HighsMipStatus mip_status);
+  std::string mipBranchingRuleToString(const int branching_rule);
 
   Tree tree_;
   const HighsOptions options_mip_;
-  const HighsLp mip_;
+  const HighsLp original_mip_;
+  // The MIP after MIP presolve, which is what the tree search solves
+  HighsLp mip_;
+
+  HighsMipPresolve presolve_;
+  bool presolved_ = false;
+  double presolve_time_ = 0;
+  // The best solution of the original MIP, and whether it satisfies
+  // the bounds, rows and integrality of the original MIP
+  std::vector<double> mip_solution_;
+  bool mip_solution_feasible_ = false;
+  double dual_bound_ = -HIGHS_CONST_INF;
 
   int num_nodes_solved = 0;
   int num_nodes_pruned = 0;
   int total_simplex_iterations = 0;
+  int num_strong_branching_lp = 0;
+  int total_strong_branching_iterations = 0;
+  int num_nodes_propagation_pruned = 0;
+  int num_nodes_lp_cutoff = 0;
+  int node_lp_cutoff_iterations = 0;
+  int num_nodes_lp_optimal = 0;
+  int node_lp_optimal_iterations = 0;
+  int num_nodes_penalty_pruned = 0;
+  int num_reduced_cost_fixed = 0;
+  double total_propagation_time = 0;
+  HighsConflictPool conflict_pool_;
+  int num_conflicts = 0;
+  int num_nodes_conflict_pruned = 0;
+  double conflict_time = 0;
+  HighsSymmetry symmetry_;
+  double symmetry_time_ = 0;
+  // The checkpoint from which the search is resumed, the nodes whose
+  // solution was abandoned when the search stopped, and the time of
+  // the last checkpoint written
+  HighsMipCheckpoint resume_checkpoint_;
+  bool resumed_ = false;
+  std::vector<Node*> unfinished_node_;
+  double last_checkpoint_time_ = 0;
+  int num_checkpoints_ = 0;
+  int num_root_cuts = 0;
+  int num_root_cut_rounds = 0;
+  double root_cut_time = 0;
+  double root_lp_objective_ = HIGHS_CONST_INF;
   double root_objective_ = HIGHS_CONST_INF;
+
+  HighsPrimalHeuristics heuristics_;
+  int num_rounding_solutions = 0;
+  int num_diving_solutions = 0;
+  int num_sub_mip_solutions = 0;
+  int heuristic_simplex_iterations = 0;
+  double heuristic_time = 0;
+  double first_incumbent_time_ = -1;
+  // Whether the root node LP was solved concurrently with IPX and the
+  // heuristics that don't need its solution, the times taken and the
+  // solutions found
+  bool concurrent_root_ = false;
+  double root_time_ = 0;
+  double root_simplex_time_ = 0;
+  double root_ipm_time_ = 0;
+  int num_trivial_solutions = 0;
+  int num_pump_solutions = 0;
+  std::vector<std::vector<double>> root_concurrent_solution_;
+  std::vector<double> root_concurrent_objective_;
+  int next_dive_rule_ = 0;
+  // Number of integer solutions found when RINS was last used
+  int rins_num_integer_solutions_ = 0;
+
+  std::vector<HighsMipWorker> workers_;
 };
 
 #endif
@@ -0,0 +1,147 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsNodeQueue.h"
+
+#include <cassert>
+
+#include "mip/SolveMip.h"
+
+void HighsNodeQueue::setup(const int node_selection_,
+                           const int best_bound_frequency_) {
+  assert(empty());
+  node_selection = node_selection_;
+  best_bound_frequency = best_bound_frequency_;
+  num_select = 0;
+}
+
+bool HighsNodeQueue::useHeap(const int heap) const {
+  // The bound heap is needed for the global bound
+  if (heap == kBoundHeap) return true;
+  return node_selection == MIP_NODE_SELECTION_BEST_ESTIMATE;
+}
+
+bool HighsNodeQueue::less(const int heap, const Node* node0,
+                          const Node* node1) const {
+  const double key0 =
+      heap == kBoundHeap ? node0->lower_bound : node0->estimate;
+  const double key1 =
+      heap == kBoundHeap ? node1->lower_bound : node1->estimate;
+  if (key0 < key1) return true;
+  if (key0 > key1) return false;
+  // Break ties in favour of deeper nodes, since they are closer to
+  // yielding an integer solution
+  return node0->level > node1->level;
+}
+
+void HighsNodeQueue::push(Node& node) {
+  assert(!node.in_queue);
+  node.in_queue = true;
+  num_node++;
+  if (node_selection == MIP_NODE_SELECTION_DEPTH_FIRST ||
+      node_selection == MIP_NODE_SELECTION_HYBRID)
+    stack_.push_back(&node);
+  for (int heap = 0; heap < kNumHeap; heap++)
+    if (useHeap(heap)) heapInsert(heap, &node);
+}
+
+Node* HighsNodeQueue::select() {
+  if (empty()) return nullptr;
+  switch (node_selection) {
+    case MIP_NODE_SELECTION_BEST_BOUND:
+      return heap_[kBoundHeap][0];
+    case MIP_NODE_SELECTION_BEST_ESTIMATE:
+      return heap_[kEstimateHeap][0];
+    case MIP_NODE_SELECTION_HYBRID:
+      // Plunge depth-first, but periodically jump to the node with
+      // the best bound
+      num_select++;
+      if (best_bound_frequency > 0 && num_select % best_bound_frequency == 0)
+        return heap_[kBoundHeap][0];
+      break;
+    default:
+      break;
+  }
+  assert(!stack_.empty() && stack_.back()->in_queue);
+  return stack_.back();
+}
+
+void HighsNodeQueue::remove(Node& node) {
+  assert(node.in_queue);
+  node.in_queue = false;
+  num_node--;
+  for (int heap = 0; heap < kNumHeap; heap++)
+    if (useHeap(heap)) heapRemove(heap, &node);
+  // Nodes are removed lazily from the stack, so ensure that the top
+  // of the stack is an open node
+  while (!stack_.empty() && !stack_.back()->in_queue) stack_.pop_back();
+}
+
+double HighsNodeQueue::getBestBound() const {
+  if (empty()) return HIGHS_CONST_INF;
+  return heap_[kBoundHeap][0]->lower_bound;
+}
+
+Node* HighsNodeQueue::getBestBoundNode() const {
+  if (empty()) return nullptr;
+  return heap_[kBoundHeap][0];
+}
+
+void HighsNodeQueue::heapSet(const int heap, const int position, Node* node) {
+  heap_[heap][position] = node;
+  node->heap_index[heap] = position;
+}
+
+void HighsNodeQueue::heapInsert(const int heap, Node* node) {
+  heap_[heap].push_back(node);
+  const int position = heap_[heap].size() - 1;
+  node->heap_index[heap] = position;
+  heapSiftUp(heap, position);
+}
+
+void HighsNodeQueue::heapRemove(const int heap, Node* node) {
+  const int position = node->heap_index[heap];
+  assert(heap_[heap][position] == node);
+  node->heap_index[heap] = -1;
+  Node* last = heap_[heap].back();
+  heap_[heap].pop_back();
+  if (last == node) return;
+  // Move the last node into the vacated position and restore the
+  // heap property
+  heapSet(heap, position, last);
+  heapSiftUp(heap, position);
+  heapSiftDown(heap, last->heap_index[heap]);
+}
+
+void HighsNodeQueue::heapSiftUp(const int heap, int position) {
+  Node* node = heap_[heap][position];
+  while (position > 0) {
+    const int parent = (position - 1) / 2;
+    if (!less(heap, node, heap_[heap][parent])) break;
+    heapSet(heap, position, heap_[heap][parent]);
+    position = parent;
+  }
+  heapSet(heap, position, node);
+}
+
+void HighsNodeQueue::heapSiftDown(const int heap, int position) {
+  const int heap_size = heap_[heap].size();
+  Node* node = heap_[heap][position];
+  for (;;) {
+    int child = 2 * position + 1;
+    if (child >= heap_size) break;
+    if (child + 1 < heap_size &&
+        less(heap, heap_[heap][child + 1], heap_[heap][child]))
+      child++;
+    if (!less(heap, heap_[heap][child], node)) break;
+    heapSet(heap, position, heap_[heap][child]);
+    position = child;
+  }
+  heapSet(heap, position, node);
+}
@@ -0,0 +1,64 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef MIP_HIGHS_NODE_QUEUE_H_
+#define MIP_HIGHS_NODE_QUEUE_H_
+
+#include <vector>
+
+#include "lp_data/HConst.h"
+
+struct Node;
+
+// Open nodes of the MIP tree. Nodes are held in a LIFO stack for
+// depth-first selection and in indexed binary heaps, keyed on their
+// lower bound and on their estimate, for best-first selection. The
+// bound heap is always maintained, so the global lower bound is
+// available in O(1) time. Nodes removed from the middle of the stack
+// are removed lazily.
+class HighsNodeQueue {
+ public:
+  void setup(const int node_selection, const int best_bound_frequency);
+
+  void push(Node& node);
+  // Select the next node to be solved, without removing it
+  Node* select();
+  void remove(Node& node);
+
+  bool empty() const { return num_node == 0; }
+  int size() const { return num_node; }
+  // The least lower bound of any open node, or +inf if there are none
+  double getBestBound() const;
+  Node* getBestBoundNode() const;
+  // Get all the open nodes, in no particular order
+  void getNodes(std::vector<Node*>& nodes) const {
+    nodes = heap_[kBoundHeap];
+  }
+
+ private:
+  enum { kBoundHeap = 0, kEstimateHeap, kNumHeap };
+
+  bool useHeap(const int heap) const;
+  bool less(const int heap, const Node* node0, const Node* node1) const;
+  void heapInsert(const int heap, Node* node);
+  void heapRemove(const int heap, Node* node);
+  void heapSiftUp(const int heap, int position);
+  void heapSiftDown(const int heap, int position);
+  void heapSet(const int heap, const int position, Node* node);
+
+  int node_selection = MIP_NODE_SELECTION_DEPTH_FIRST;
+  int best_bound_frequency = 0;
+  int num_select = 0;
+  int num_node = 0;
+
+  std::vector<Node*> stack_;
+  std::vector<Node*> heap_[kNumHeap];
+};
+
+#endif
@@ -0,0 +1,73 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsPackedBasis.h"
+
+#include <cassert>
+
+// Number of statuses packed into each 64-bit word
+const int kStatusPerWord = 32;
+
+void HighsPackedBasis::pack(const HighsBasis& basis) {
+  assert(basis.valid_);
+  num_col = basis.col_status.size();
+  num_row = basis.row_status.size();
+  const int num_tot = num_col + num_row;
+  packed_status.assign((num_tot + kStatusPerWord - 1) / kStatusPerWord, 0);
+  other_status.clear();
+  for (int iVar = 0; iVar < num_tot; iVar++) {
+    const HighsBasisStatus status = iVar < num_col
+                                        ? basis.col_status[iVar]
+                                        : basis.row_status[iVar - num_col];
+    uint64_t bits = (uint64_t)status;
+    if (status > HighsBasisStatus::ZERO) {
+      // Status can't be packed, so record it explicitly and pack as LOWER
+      other_status.push_back(std::make_pair(iVar, status));
+      bits = (uint64_t)HighsBasisStatus::LOWER;
+    }
+    const int shift = 2 * (iVar % kStatusPerWord);
+    packed_status[iVar / kStatusPerWord] |= bits << shift;
+  }
+}
+
+void HighsPackedBasis::unpack(HighsBasis& basis) const {
+  basis.col_status.resize(num_col);
+  basis.row_status.resize(num_row);
+  const int num_tot = num_col + num_row;
+  for (int iVar = 0; iVar < num_tot; iVar++) {
+    const int shift = 2 * (iVar % kStatusPerWord);
+    const HighsBasisStatus status = (HighsBasisStatus)(
+        (packed_status[iVar / kStatusPerWord] >> shift) & 3);
+    if (iVar < num_col) {
+      basis.col_status[iVar] = status;
+    } else {
+      basis.row_status[iVar - num_col] = status;
+    }
+  }
+  for (const std::pair<int, HighsBasisStatus>& other : other_status) {
+    if (other.first < num_col) {
+      basis.col_status[other.first] = other.second;
+    } else {
+      basis.row_status[other.first - num_col] = other.second;
+    }
+  }
+  basis.valid_ = true;
+}
+
+void HighsPackedBasis::clear() {
+  num_col = 0;
+  num_row = 0;
+  std::vector<uint64_t>().swap(packed_status);
+  std::vector<std::pair<int, HighsBasisStatus> >().swap(other_status);
+}
+
+int HighsPackedBasis::size() const {
+  return packed_status.size() * sizeof(uint64_t) +
+         other_status.size() * sizeof(std::pair<int, HighsBasisStatus>);
+}
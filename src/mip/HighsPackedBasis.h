@@ -0,0 +1,41 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef MIP_HIGHS_PACKED_BASIS_H_
+#define MIP_HIGHS_PACKED_BASIS_H_
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "lp_data/HStruct.h"
+
+// A HighsBasis packed into two bits per column and row. The statuses
+// LOWER, BASIC, UPPER and ZERO are packed, and the rare others are
+// held explicitly.
+class HighsPackedBasis {
+ public:
+  void pack(const HighsBasis& basis);
+  void unpack(HighsBasis& basis) const;
+  bool empty() const { return num_col == 0 && num_row == 0; }
+  void clear();
+  // Number of bytes used to hold the basis
+  int size() const;
+
+ private:
+  // Checkpoints of the MIP search write and read the data directly
+  friend struct HighsMipCheckpoint;
+
+  int num_col = 0;
+  int num_row = 0;
+  std::vector<uint64_t> packed_status;
+  std::vector<std::pair<int, HighsBasisStatus> > other_status;
+};
+
+#endif
@@ -0,0 +1,386 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsPrimalHeuristics.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "util/HighsUtils.h"
+
+void HighsPrimalHeuristics::setup(const HighsLp& mip, const HighsLp& lp,
+                                  const HighsBasis& basis,
+                                  const HighsOptions& options) {
+  setupLocks(mip, options);
+  dive_highs_.reset(new Highs(lp_options_));
+  dive_highs_->passModel(lp);
+  dive_highs_->setBasis(basis);
+}
+
+void HighsPrimalHeuristics::setupLocks(const HighsLp& mip,
+                                       const HighsOptions& options) {
+  mip_ = &mip;
+  feasibility_tolerance_ = options.primal_feasibility_tolerance;
+  const int num_col = mip.numCol_;
+  down_locks_.assign(num_col, 0);
+  up_locks_.assign(num_col, 0);
+  for (int iCol = 0; iCol < num_col; iCol++) {
+    for (int el = mip.Astart_[iCol]; el < mip.Astart_[iCol + 1]; el++) {
+      const int iRow = mip.Aindex_[el];
+      const bool finite_lower = !highs_isInfinity(-mip.rowLower_[iRow]);
+      const bool finite_upper = !highs_isInfinity(mip.rowUpper_[iRow]);
+      // Decreasing a column with a positive coefficient may violate
+      // the lower bound on the row
+      if (mip.Avalue_[el] > 0) {
+        if (finite_lower) down_locks_[iCol]++;
+        if (finite_upper) up_locks_[iCol]++;
+      } else {
+        if (finite_upper) down_locks_[iCol]++;
+        if (finite_lower) up_locks_[iCol]++;
+      }
+    }
+  }
+
+  lp_options_ = options;
+  lp_options_.logfile = NULL;
+  lp_options_.message_level = 0;
+  lp_options_.presolve = off_string;
+  lp_options_.solver = simplex_string;
+  pump_highs_.reset();
+  all_cols_.resize(num_col);
+  for (int iCol = 0; iCol < num_col; iCol++) all_cols_[iCol] = iCol;
+}
+
+bool HighsPrimalHeuristics::round(const std::vector<double>& lp_solution,
+                                  std::vector<double>& solution,
+                                  double& objective) {
+  const HighsLp& mip = *mip_;
+  solution = lp_solution;
+  for (int iCol = 0; iCol < mip.numCol_; iCol++) {
+    if (!mip.integrality_[iCol]) continue;
+    const double value = lp_solution[iCol];
+    const double nearest = std::floor(value + 0.5);
+    if (std::fabs(value - nearest) <= integer_tolerance) {
+      solution[iCol] = nearest;
+    } else if (down_locks_[iCol] == 0) {
+      solution[iCol] = std::floor(value);
+    } else if (up_locks_[iCol] == 0) {
+      solution[iCol] = std::ceil(value);
+    } else {
+      solution[iCol] = nearest;
+    }
+  }
+  return isFeasible(solution, objective);
+}
+
+// Interrupts the LP solves of the feasibility pump when it's asked to
+// stop
+static int pumpStopCallback(const int callback_type,
+                            const HighsCallbackDataOut* data_out,
+                            void* user_callback_data) {
+  return ((const std::atomic<bool>*)user_callback_data)
+      ->load(std::memory_order_relaxed);
+}
+
+bool HighsPrimalHeuristics::trivial(std::vector<double>& solution,
+                                    double& objective) {
+  const HighsLp& mip = *mip_;
+  const int num_col = mip.numCol_;
+  std::vector<double> trial(num_col);
+  double trial_objective;
+  bool found = false;
+  objective = HIGHS_CONST_INF;
+  for (int rule = 0; rule < 4; rule++) {
+    for (int iCol = 0; iCol < num_col; iCol++) {
+      const double lower = mip.colLower_[iCol];
+      const double upper = mip.colUpper_[iCol];
+      const bool finite_lower = !highs_isInfinity(-lower);
+      const bool finite_upper = !highs_isInfinity(upper);
+      bool at_lower;
+      switch (rule) {
+        case 0:
+          at_lower = true;
+          break;
+        case 1:
+          at_lower = false;
+          break;
+        case 2:
+          // The value of least magnitude
+          at_lower = lower >= 0;
+          if (lower < 0 && upper > 0) {
+            trial[iCol] = 0;
+            continue;
+          }
+          break;
+        default:
+          if (down_locks_[iCol] == 0) {
+            at_lower = true;
+          } else if (up_locks_[iCol] == 0) {
+            at_lower = false;
+          } else {
+            at_lower = mip.colCost_[iCol] >= 0;
+          }
+          break;
+      }
+      if (at_lower ? !finite_lower : !finite_upper) at_lower = !at_lower;
+      if (at_lower && finite_lower) {
+        trial[iCol] = lower;
+      } else if (!at_lower && finite_upper) {
+        trial[iCol] = upper;
+      } else {
+        trial[iCol] = 0;
+      }
+    }
+    if (isFeasible(trial, trial_objective) && trial_objective < objective) {
+      found = true;
+      objective = trial_objective;
+      solution = trial;
+    }
+  }
+  return found;
+}
+
+bool HighsPrimalHeuristics::feasibilityPump(
+    const std::vector<double>& start, const int iteration_limit,
+    const std::atomic<bool>& stop, std::vector<double>& solution,
+    double& objective, int& iteration_count) {
+  iteration_count = 0;
+  if (!pump_highs_) {
+    pump_highs_.reset(new Highs(lp_options_));
+    pump_highs_->passModel(*mip_);
+  }
+  Highs& highs = *pump_highs_;
+  highs.setCallback(pumpStopCallback, (void*)&stop);
+  const bool found = pump(highs, start, iteration_limit, stop, solution,
+                          objective, iteration_count);
+  highs.setCallback(NULL);
+  return found;
+}
+
+bool HighsPrimalHeuristics::pump(Highs& highs,
+                                 const std::vector<double>& start,
+                                 const int iteration_limit,
+                                 const std::atomic<bool>& stop,
+                                 std::vector<double>& solution,
+                                 double& objective, int& iteration_count) {
+  const HighsLp& mip = *mip_;
+  const int num_col = mip.numCol_;
+
+  // Scale the objective so that its norm is that of the distance
+  // function when all integer columns are at bounds
+  int num_integer = 0;
+  double cost_norm = 0;
+  for (int iCol = 0; iCol < num_col; iCol++) {
+    if (mip.integrality_[iCol]) num_integer++;
+    cost_norm += mip.colCost_[iCol] * mip.colCost_[iCol];
+  }
+  cost_norm = std::sqrt(cost_norm);
+  const double objective_scale =
+      cost_norm > 0 ? std::sqrt((double)num_integer) / cost_norm : 0;
+  double objective_weight = 1;
+
+  std::vector<double> value = start;
+  std::vector<double> previous_rounded;
+  std::vector<double> cost(num_col);
+  std::vector<std::pair<double, int>> distance;
+  for (int round = 0; round < pump_max_rounds; round++) {
+    if (stop.load(std::memory_order_relaxed)) return false;
+    solution = value;
+    for (int iCol = 0; iCol < num_col; iCol++) {
+      if (!mip.integrality_[iCol]) continue;
+      solution[iCol] =
+          std::min(std::max(std::floor(value[iCol] + 0.5), mip.colLower_[iCol]),
+                   mip.colUpper_[iCol]);
+    }
+    if (isFeasible(solution, objective)) return true;
+    if (solution == previous_rounded) {
+      // Flip the roundings of the integer columns whose values are
+      // furthest from them
+      distance.clear();
+      for (int iCol = 0; iCol < num_col; iCol++) {
+        if (!mip.integrality_[iCol]) continue;
+        const double gap = std::fabs(value[iCol] - solution[iCol]);
+        if (gap > integer_tolerance)
+          distance.push_back(std::make_pair(-gap, iCol));
+      }
+      if (distance.empty()) return false;
+      std::sort(distance.begin(), distance.end());
+      const int num_flip = std::min((int)distance.size(), pump_num_flip);
+      for (int ix = 0; ix < num_flip; ix++) {
+        const int iCol = distance[ix].second;
+        solution[iCol] += value[iCol] > solution[iCol] ? 1 : -1;
+      }
+    }
+    previous_rounded = solution;
+
+    for (int iCol = 0; iCol < num_col; iCol++) {
+      cost[iCol] = objective_weight * objective_scale * mip.colCost_[iCol];
+      if (!mip.integrality_[iCol]) continue;
+      if (solution[iCol] <= mip.colLower_[iCol]) {
+        cost[iCol] += 1;
+      } else if (solution[iCol] >= mip.colUpper_[iCol]) {
+        cost[iCol] -= 1;
+      }
+    }
+    objective_weight *= pump_objective_decay;
+    highs.changeColsCost(num_col, &all_cols_[0], &cost[0]);
+    if (!solveLp(highs, iteration_count) ||
+        iteration_count > iteration_limit)
+      return false;
+    value = highs.getSolution().col_value;
+  }
+  return false;
+}
+
+bool HighsPrimalHeuristics::dive(const HighsDiveRule rule,
+                                 const std::vector<double>& col_lower,
+                                 const std::vector<double>& col_upper,
+                                 const std::vector<double>& lp_solution,
+                                 const std::vector<double>& incumbent,
+                                 const double cutoff, const int iteration_limit,
+                                 std::vector<double>& solution,
+                                 double& objective, int& iteration_count) {
+  iteration_count = 0;
+  if (!dive_highs_) return false;
+  return dive(*dive_highs_, rule, col_lower, col_upper, lp_solution, incumbent,
+              cutoff, iteration_limit, solution, objective, iteration_count);
+}
+
+bool HighsPrimalHeuristics::dive(Highs& highs, const HighsDiveRule rule,
+                                 const std::vector<double>& col_lower,
+                                 const std::vector<double>& col_upper,
+                                 const std::vector<double>& lp_solution,
+                                 const std::vector<double>& incumbent,
+                                 const double cutoff, const int iteration_limit,
+                                 std::vector<double>& solution,
+                                 double& objective, int& iteration_count) {
+  const HighsLp& mip = *mip_;
+  iteration_count = 0;
+  std::vector<double> lower = col_lower;
+  std::vector<double> upper = col_upper;
+  highs.changeColsBounds(mip.numCol_, &all_cols_[0], &lower[0], &upper[0]);
+  std::vector<double> value = lp_solution;
+  int num_integer = 0;
+  for (int iCol = 0; iCol < mip.numCol_; iCol++)
+    if (mip.integrality_[iCol]) num_integer++;
+  const int max_depth =
+      dive_max_depth_fraction * num_integer + dive_min_max_depth;
+  for (int depth = 0; depth < max_depth; depth++) {
+    if (round(value, solution, objective) && objective < cutoff) return true;
+    bool up;
+    const int col = chooseDiveColumn(rule, value, lower, upper, incumbent, up);
+    // If there's no fractional column then rounding has failed on an
+    // integral solution, so the dive can't continue
+    if (col < 0) return false;
+    const double col_value = value[col];
+    const double old_lower = lower[col];
+    const double old_upper = upper[col];
+    // Bound the column in the chosen direction, backtracking to the
+    // other direction if the LP is infeasible or cut off
+    bool solved = false;
+    for (const bool branch_up : {up, !up}) {
+      lower[col] = branch_up ? std::ceil(col_value) : old_lower;
+      upper[col] = branch_up ? old_upper : std::floor(col_value);
+      highs.changeColBounds(col, lower[col], upper[col]);
+      solved = solveLp(highs, iteration_count) &&
+               highs.getObjectiveValue() < cutoff;
+      if (solved || iteration_count > iteration_limit) break;
+    }
+    if (!solved || iteration_count > iteration_limit) return false;
+    value = highs.getSolution().col_value;
+  }
+  return false;
+}
+
+bool HighsPrimalHeuristics::isFeasible(const std::vector<double>& solution,
+                                       double& objective) const {
+  const HighsLp& mip = *mip_;
+  std::vector<double> row_activity(mip.numRow_, 0);
+  objective = mip.offset_;
+  for (int iCol = 0; iCol < mip.numCol_; iCol++) {
+    const double value = solution[iCol];
+    const double lower = mip.colLower_[iCol];
+    const double upper = mip.colUpper_[iCol];
+    if (value <
+            lower - feasibility_tolerance_ * std::max(1.0, std::fabs(lower)) ||
+        value >
+            upper + feasibility_tolerance_ * std::max(1.0, std::fabs(upper)))
+      return false;
+    if (mip.integrality_[iCol] &&
+        std::fabs(value - std::floor(value + 0.5)) > integer_tolerance)
+      return false;
+    objective += mip.colCost_[iCol] * value;
+    for (int el = mip.Astart_[iCol]; el < mip.Astart_[iCol + 1]; el++)
+      row_activity[mip.Aindex_[el]] += mip.Avalue_[el] * value;
+  }
+  for (int iRow = 0; iRow < mip.numRow_; iRow++) {
+    const double lower = mip.rowLower_[iRow];
+    const double upper = mip.rowUpper_[iRow];
+    if (row_activity[iRow] <
+        lower - feasibility_tolerance_ * std::max(1.0, std::fabs(lower)))
+      return false;
+    if (row_activity[iRow] >
+        upper + feasibility_tolerance_ * std::max(1.0, std::fabs(upper)))
+      return false;
+  }
+  return true;
+}
+
+int HighsPrimalHeuristics::chooseDiveColumn(
+    const HighsDiveRule rule, const std::vector<double>& value,
+    const std::vector<double>& col_lower, const std::vector<double>& col_upper,
+    const std::vector<double>& incumbent, bool& up) const {
+  const HighsLp& mip = *mip_;
+  const bool guided = rule == HighsDiveRule::kGuided && !incumbent.empty();
+  int best_col = -1;
+  double best_score = HIGHS_CONST_INF;
+  for (int iCol = 0; iCol < mip.numCol_; iCol++) {
+    if (!mip.integrality_[iCol]) continue;
+    if (col_lower[iCol] == col_upper[iCol]) continue;
+    const double fraction = value[iCol] - std::floor(value[iCol]);
+    if (fraction <= integer_tolerance || fraction >= 1 - integer_tolerance)
+      continue;
+    bool col_up;
+    double score;
+    if (guided) {
+      // Round towards the incumbent, preferring the columns closest
+      // to it
+      col_up = incumbent[iCol] > value[iCol];
+      score = std::fabs(incumbent[iCol] - value[iCol]);
+    } else if (rule == HighsDiveRule::kCoefficient) {
+      // Round in the direction with fewer locks, preferring the
+      // columns with fewest locks, then the smallest fractions
+      if (down_locks_[iCol] != up_locks_[iCol]) {
+        col_up = up_locks_[iCol] < down_locks_[iCol];
+      } else {
+        col_up = fraction > 0.5;
+      }
+      score = std::min(down_locks_[iCol], up_locks_[iCol]) +
+              (col_up ? 1 - fraction : fraction);
+    } else {
+      // Round to the nearest integer, preferring the columns that are
+      // closest to one
+      col_up = fraction > 0.5;
+      score = std::min(fraction, 1 - fraction);
+    }
+    if (score < best_score) {
+      best_score = score;
+      best_col = iCol;
+      up = col_up;
+    }
+  }
+  return best_col;
+}
+
+bool HighsPrimalHeuristics::solveLp(Highs& highs, int& iteration_count) {
+  HighsStatus run_status = highs.run();
+  iteration_count += highs.getHighsInfo().simplex_iteration_count;
+  return run_status != HighsStatus::Error &&
+         highs.getModelStatus() == HighsModelStatus::OPTIMAL;
+}
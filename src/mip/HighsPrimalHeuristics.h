@@ -0,0 +1,129 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef MIP_HIGHS_PRIMAL_HEURISTICS_H_
+#define MIP_HIGHS_PRIMAL_HEURISTICS_H_
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "Highs.h"
+
+enum class HighsDiveRule { kFractional = 0, kCoefficient, kGuided, kCount };
+
+// Rounding and diving heuristics for finding integer feasible
+// solutions of a MIP from the solutions of its LP relaxation. Dives
+// are performed on a separate copy of the LP relaxation, which may
+// contain cuts. The trivial heuristics and the feasibility pump don't
+// need a solution of the LP relaxation, so can run while it's being
+// solved.
+class HighsPrimalHeuristics {
+ public:
+  void setup(const HighsLp& mip, const HighsLp& lp, const HighsBasis& basis,
+             const HighsOptions& options);
+  // Set up only what is needed by the heuristics that don't dive
+  void setupLocks(const HighsLp& mip, const HighsOptions& options);
+
+  // Round the fractional integer columns of an LP solution in a
+  // direction that can't violate any row, if there is one, and
+  // otherwise to the nearest integer. Returns true if the rounded
+  // solution is feasible for the MIP.
+  bool round(const std::vector<double>& lp_solution,
+             std::vector<double>& solution, double& objective);
+
+  // Try the solutions with every column at its lower bound, at its
+  // upper bound, at the value of least magnitude, and at the bound in
+  // a direction that can't violate any row (or that of least cost if
+  // there is none). Returns true if one is feasible for the MIP,
+  // giving the best.
+  bool trivial(std::vector<double>& solution, double& objective);
+
+  // Feasibility pump from a point that satisfies the rows, such as an
+  // interior point of the LP relaxation. Each round, the integer
+  // columns are rounded, and the LP relaxation is solved with the
+  // objective replaced by the distance from the rounded values of
+  // the integer columns at their bounds plus a decaying multiple of
+  // the objective. Cycles are broken by flipping the roundings of the
+  // integer columns furthest from their rounded values. Stops when
+  // stop is set.
+  bool feasibilityPump(const std::vector<double>& start,
+                       const int iteration_limit,
+                       const std::atomic<bool>& stop,
+                       std::vector<double>& solution, double& objective,
+                       int& iteration_count);
+
+  // Starting from the LP solution for the given column bounds,
+  // repeatedly bound a fractional integer column chosen by the rule
+  // and re-solve the LP, backtracking once if it becomes infeasible.
+  // Returns true if a solution with objective below cutoff is found.
+  // Guided dives round towards the incumbent.
+  bool dive(const HighsDiveRule rule, const std::vector<double>& col_lower,
+            const std::vector<double>& col_upper,
+            const std::vector<double>& lp_solution,
+            const std::vector<double>& incumbent, const double cutoff,
+            const int iteration_limit, std::vector<double>& solution,
+            double& objective, int& iteration_count);
+  // Dive using the LP relaxation in the given Highs instance rather
+  // than that of the heuristics, leaving its column bounds changed
+  bool dive(Highs& highs, const HighsDiveRule rule,
+            const std::vector<double>& col_lower,
+            const std::vector<double>& col_upper,
+            const std::vector<double>& lp_solution,
+            const std::vector<double>& incumbent, const double cutoff,
+            const int iteration_limit, std::vector<double>& solution,
+            double& objective, int& iteration_count);
+
+  // Whether a solution satisfies the integrality, bounds and rows of
+  // the MIP, and its objective value
+  bool isFeasible(const std::vector<double>& solution,
+                  double& objective) const;
+
+ private:
+  int chooseDiveColumn(const HighsDiveRule rule,
+                       const std::vector<double>& value,
+                       const std::vector<double>& col_lower,
+                       const std::vector<double>& col_upper,
+                       const std::vector<double>& incumbent, bool& up) const;
+  bool pump(Highs& highs, const std::vector<double>& start,
+            const int iteration_limit, const std::atomic<bool>& stop,
+            std::vector<double>& solution, double& objective,
+            int& iteration_count);
+  bool solveLp(Highs& highs, int& iteration_count);
+
+  const HighsLp* mip_ = nullptr;
+  double feasibility_tolerance_ = 0;
+  // Options for the LPs solved by the heuristics
+  HighsOptions lp_options_;
+  // Number of rows that may become infeasible if each column is
+  // decreased or increased
+  std::vector<int> down_locks_;
+  std::vector<int> up_locks_;
+  std::unique_ptr<Highs> dive_highs_;
+  std::unique_ptr<Highs> pump_highs_;
+  std::vector<int> all_cols_;
+  std::vector<double> row_activity_;
+};
+
+// Dives are at most dive_max_depth_fraction times the number of
+// integer columns plus dive_min_max_depth deep, since general integer
+// columns may be bounded more than once. Values are integral if
+// they're within integer_tolerance of an integer.
+const double dive_max_depth_fraction = 2;
+const int dive_min_max_depth = 10;
+const double integer_tolerance = 1e-7;
+
+// The feasibility pump performs at most pump_max_rounds rounds,
+// flips pump_num_flip roundings to break a cycle, and multiplies the
+// weight of the objective by pump_objective_decay each round.
+const int pump_max_rounds = 100;
+const int pump_num_flip = 10;
+const double pump_objective_decay = 0.9;
+
+#endif
@@ -0,0 +1,57 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsPseudocost.h"
+
+#include <algorithm>
+
+// Lower limit on the gain in each direction when computing the
+// product score, so that a zero gain in one direction doesn't
+// eliminate the other
+const double min_score_gain = 1e-6;
+
+void HighsPseudocost::setup(const int num_col) {
+  sum_down.assign(num_col, 0);
+  sum_up.assign(num_col, 0);
+  num_down.assign(num_col, 0);
+  num_up.assign(num_col, 0);
+  sum_all[0] = 0;
+  sum_all[1] = 0;
+  num_all[0] = 0;
+  num_all[1] = 0;
+}
+
+void HighsPseudocost::addObservation(const int col, const bool up,
+                                     const double unit_gain) {
+  const double gain = std::max(unit_gain, 0.0);
+  if (up) {
+    sum_up[col] += gain;
+    num_up[col]++;
+  } else {
+    sum_down[col] += gain;
+    num_down[col]++;
+  }
+  sum_all[up] += gain;
+  num_all[up]++;
+}
+
+double HighsPseudocost::getPseudocost(const int col, const bool up) const {
+  const int num = up ? num_up[col] : num_down[col];
+  if (num > 0) return (up ? sum_up[col] : sum_down[col]) / num;
+  if (num_all[up] > 0) return sum_all[up] / num_all[up];
+  // No observations, so all columns are equally good
+  return 1;
+}
+
+double HighsPseudocost::getScore(const int col, const double fraction) const {
+  const double down_gain = getPseudocost(col, false) * fraction;
+  const double up_gain = getPseudocost(col, true) * (1 - fraction);
+  return std::max(down_gain, min_score_gain) *
+         std::max(up_gain, min_score_gain);
+}
@@ -0,0 +1,46 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef MIP_HIGHS_PSEUDOCOST_H_
+#define MIP_HIGHS_PSEUDOCOST_H_
+
+#include <vector>
+
+// Pseudocosts: for each column, the average objective gain per unit
+// change in its value when it is branched down and up. Columns that
+// have not been branched on in a direction use the average over all
+// columns.
+class HighsPseudocost {
+ public:
+  void setup(const int num_col);
+  int numCol() const { return sum_down.size(); }
+
+  void addObservation(const int col, const bool up, const double unit_gain);
+
+  double getPseudocost(const int col, const bool up) const;
+  int getNumObservation(const int col) const {
+    return num_down[col] < num_up[col] ? num_down[col] : num_up[col];
+  }
+  // Product score for branching on a column with the given
+  // fractional part
+  double getScore(const int col, const double fraction) const;
+
+ private:
+  // Checkpoints of the MIP search write and read the data directly
+  friend struct HighsMipCheckpoint;
+
+  std::vector<double> sum_down;
+  std::vector<double> sum_up;
+  std::vector<int> num_down;
+  std::vector<int> num_up;
+  double sum_all[2] = {0, 0};
+  int num_all[2] = {0, 0};
+};
+
+#endif
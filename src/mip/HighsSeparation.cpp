@@ -0,0 +1,418 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsSeparation.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "lp_data/HighsLpUtils.h"
+#include "util/HighsUtils.h"
+
+// Coefficients of Gomory mixed-integer cuts for a nonbasic column
+// with tableau entry value in a row whose basic variable has
+// fractional part f0
+static double gomoryIntegerCoefficient(const double value, const double f0) {
+  const double f = value - std::floor(value);
+  return f <= f0 ? f / f0 : (1 - f) / (1 - f0);
+}
+
+static double gomoryContinuousCoefficient(const double value,
+                                          const double f0) {
+  return value >= 0 ? value / f0 : -value / (1 - f0);
+}
+
+void HighsSeparation::setup(const HighsLp& mip,
+                            const double feasibility_tolerance) {
+  mip_ = &mip;
+  feasibility_tolerance_ = feasibility_tolerance;
+  getRowwiseMatrix(mip, ar_start_, ar_index_, ar_value_);
+  cut_value_.assign(mip.numCol_, 0);
+  in_cut_.assign(mip.numCol_, 0);
+  cut_index_.clear();
+  cut_lower_ = 0;
+}
+
+int HighsSeparation::separateGomory(Highs& highs, HighsCutPool& cut_pool) {
+  const HighsLp& lp = highs.getLp();
+  const HighsBasis& basis = highs.getBasis();
+  const HighsSolution& solution = highs.getSolution();
+  const std::vector<double>& col_value = solution.col_value;
+  const std::vector<double>& row_value = solution.row_value;
+  const int num_col = lp.numCol_;
+  const int num_row = lp.numRow_;
+  if (!basis.valid_ || num_row == 0) return 0;
+  std::vector<int> basic_variables(num_row);
+  if (highs.getBasicVariables(&basic_variables[0]) != HighsStatus::OK)
+    return 0;
+
+  // Choose the tableau rows whose basic variables are integer and
+  // most fractional
+  std::vector<std::pair<double, int> > candidate;
+  for (int iRow = 0; iRow < num_row; iRow++) {
+    const int iCol = basic_variables[iRow];
+    if (iCol < 0 || !lp.integrality_[iCol]) continue;
+    const double fraction = col_value[iCol] - std::floor(col_value[iCol]);
+    if (fraction < gomory_min_fraction || fraction > 1 - gomory_min_fraction)
+      continue;
+    candidate.push_back(
+        std::make_pair(-std::min(fraction, 1 - fraction), iRow));
+  }
+  if (candidate.empty()) return 0;
+  std::sort(candidate.begin(), candidate.end());
+  if ((int)candidate.size() > gomory_max_num_row)
+    candidate.resize(gomory_max_num_row);
+
+  // The row activities of the LP, which may contain cuts, are
+  // substituted out of the cuts using its row-wise matrix
+  std::vector<int> ar_start;
+  std::vector<int> ar_index;
+  std::vector<double> ar_value;
+  getRowwiseMatrix(lp, ar_start, ar_index, ar_value);
+
+  std::vector<double> basis_inverse_row(num_row);
+  std::vector<double> reduced_row(num_col);
+  int num_cut = 0;
+  for (const std::pair<double, int>& entry : candidate) {
+    const int iRow = entry.second;
+    const double basic_value = col_value[basic_variables[iRow]];
+    const double f0 = basic_value - std::floor(basic_value);
+    if (highs.getBasisInverseRow(iRow, &basis_inverse_row[0]) !=
+            HighsStatus::OK ||
+        highs.getReducedRow(iRow, &reduced_row[0], NULL, NULL,
+                            &basis_inverse_row[0]) != HighsStatus::OK)
+      break;
+    // The tableau row is x_B + sum_j g_j t_j = basic_value, where
+    // t_j >= 0 is the distance of nonbasic variable j from the bound
+    // at which it's held. Row activities r = Ax have tableau entries
+    // -basis_inverse_row. The cut sum_j coefficient_j t_j >= 1 is
+    // formed in terms of the columns.
+    clearCut();
+    cut_lower_ = 1;
+    bool valid = true;
+    for (int iCol = 0; iCol < num_col && valid; iCol++) {
+      if (basis.col_status[iCol] == HighsBasisStatus::BASIC) continue;
+      const double value = reduced_row[iCol];
+      if (std::fabs(value) <= cut_small_coefficient) continue;
+      const double lower = lp.colLower_[iCol];
+      const double upper = lp.colUpper_[iCol];
+      const bool at_lower = col_value[iCol] <= lower + feasibility_tolerance_;
+      if (!at_lower && col_value[iCol] < upper - feasibility_tolerance_) {
+        valid = false;
+        break;
+      }
+      const double g = at_lower ? value : -value;
+      const double coefficient = lp.integrality_[iCol]
+                                     ? gomoryIntegerCoefficient(g, f0)
+                                     : gomoryContinuousCoefficient(g, f0);
+      if (at_lower) {
+        addToCut(iCol, coefficient);
+        cut_lower_ += coefficient * lower;
+      } else {
+        addToCut(iCol, -coefficient);
+        cut_lower_ -= coefficient * upper;
+      }
+    }
+    for (int iRow = 0; iRow < num_row && valid; iRow++) {
+      if (basis.row_status[iRow] == HighsBasisStatus::BASIC) continue;
+      const double value = -basis_inverse_row[iRow];
+      if (std::fabs(value) <= cut_small_coefficient) continue;
+      const double lower = lp.rowLower_[iRow];
+      const double upper = lp.rowUpper_[iRow];
+      const bool at_lower = row_value[iRow] <= lower + feasibility_tolerance_;
+      if (!at_lower && row_value[iRow] < upper - feasibility_tolerance_) {
+        valid = false;
+        break;
+      }
+      const double g = at_lower ? value : -value;
+      double coefficient = gomoryContinuousCoefficient(g, f0);
+      if (at_lower) {
+        cut_lower_ += coefficient * lower;
+      } else {
+        cut_lower_ -= coefficient * upper;
+        coefficient = -coefficient;
+      }
+      for (int el = ar_start[iRow]; el < ar_start[iRow + 1]; el++)
+        addToCut(ar_index[el], coefficient * ar_value[el]);
+    }
+    if (valid && addCut(col_value, cut_pool)) num_cut++;
+  }
+  clearCut();
+  return num_cut;
+}
+
+int HighsSeparation::separateKnapsackCover(const std::vector<double>& solution,
+                                           HighsCutPool& cut_pool) {
+  const HighsLp& mip = *mip_;
+  int num_cut = 0;
+  std::vector<std::pair<double, int> > item;
+  for (int iRow = 0; iRow < mip.numRow_; iRow++) {
+    bool binary = ar_start_[iRow] < ar_start_[iRow + 1];
+    for (int el = ar_start_[iRow]; el < ar_start_[iRow + 1] && binary; el++) {
+      const int iCol = ar_index_[el];
+      binary = mip.integrality_[iCol] && mip.colLower_[iCol] == 0 &&
+               mip.colUpper_[iCol] == 1;
+    }
+    if (!binary) continue;
+    // Consider the row as sum_j a_j x_j <= b, for each finite bound
+    for (const double sign : {1.0, -1.0}) {
+      const double bound =
+          sign > 0 ? mip.rowUpper_[iRow] : -mip.rowLower_[iRow];
+      if (highs_isInfinity(bound)) continue;
+      // Complement columns with negative coefficients, so that the
+      // row is sum_j |a_j| y_j <= rhs
+      double rhs = bound;
+      double sum = 0;
+      item.clear();
+      for (int el = ar_start_[iRow]; el < ar_start_[iRow + 1]; el++) {
+        const double value = sign * ar_value_[el];
+        const int iCol = ar_index_[el];
+        if (value < 0) rhs -= value;
+        sum += std::fabs(value);
+        const double y = value > 0 ? solution[iCol] : 1 - solution[iCol];
+        // Order by 1-y, breaking ties by larger coefficient
+        item.push_back(std::make_pair(1 - y - 1e-9 * std::fabs(value), el));
+      }
+      if (sum <= rhs + feasibility_tolerance_) continue;
+      // Form a cover greedily from the columns with the largest values
+      std::sort(item.begin(), item.end());
+      double cover_weight = 0;
+      double max_cover_value = 0;
+      int cover_size = 0;
+      for (const std::pair<double, int>& entry : item) {
+        const double value = std::fabs(ar_value_[entry.second]);
+        cover_weight += value;
+        max_cover_value = std::max(value, max_cover_value);
+        cover_size++;
+        if (cover_weight > rhs + feasibility_tolerance_) break;
+      }
+      if (cover_weight <= rhs + feasibility_tolerance_) continue;
+      // The cover inequality sum_{C} y_j <= |C| - 1 is extended to
+      // include the columns with coefficients at least as large as
+      // any in the cover. It's formed as -sum_{E} y_j >= 1 - |C|.
+      clearCut();
+      cut_lower_ = 1 - cover_size;
+      for (int ix = 0; ix < (int)item.size(); ix++) {
+        const int el = item[ix].second;
+        const double value = sign * ar_value_[el];
+        if (ix >= cover_size && std::fabs(value) < max_cover_value) continue;
+        if (value > 0) {
+          addToCut(ar_index_[el], -1);
+        } else {
+          // -y = x - 1
+          addToCut(ar_index_[el], 1);
+          cut_lower_ += 1;
+        }
+      }
+      if (addCut(solution, cut_pool)) num_cut++;
+    }
+  }
+  clearCut();
+  return num_cut;
+}
+
+int HighsSeparation::separateMir(const std::vector<double>& solution,
+                                 HighsCutPool& cut_pool) {
+  const HighsLp& mip = *mip_;
+  int num_cut = 0;
+  MirRow mir_row;
+  std::vector<double> delta;
+  for (int iRow = 0; iRow < mip.numRow_; iRow++) {
+    for (const double sign : {1.0, -1.0}) {
+      if (!transformMirRow(iRow, sign, solution, mir_row)) continue;
+      // Try dividing the row by the coefficients of integer columns
+      // strictly between their bounds
+      delta.clear();
+      for (int ix = 0; ix < (int)mir_row.col.size(); ix++) {
+        const int iCol = mir_row.col[ix];
+        if (!mip.integrality_[iCol]) continue;
+        const double value = std::fabs(mir_row.value[ix]);
+        if (value <= cut_small_coefficient) continue;
+        if (solution[iCol] <= mip.colLower_[iCol] + feasibility_tolerance_ ||
+            solution[iCol] >= mip.colUpper_[iCol] - feasibility_tolerance_)
+          continue;
+        if (std::find(delta.begin(), delta.end(), value) == delta.end())
+          delta.push_back(value);
+        if (delta.size() >= 8) break;
+      }
+      if (delta.empty()) continue;
+      double best_delta = 0;
+      double best_efficacy = cut_min_efficacy;
+      for (double candidate_delta : delta) {
+        if (!formMirCut(mir_row, candidate_delta)) continue;
+        const double efficacy = cutEfficacy(solution);
+        if (efficacy > best_efficacy) {
+          best_efficacy = efficacy;
+          best_delta = candidate_delta;
+        }
+      }
+      if (best_delta <= 0) continue;
+      // See whether dividing the best delta improves the cut
+      const double initial_best_delta = best_delta;
+      for (const double divisor : {2.0, 4.0, 8.0}) {
+        if (!formMirCut(mir_row, initial_best_delta / divisor)) continue;
+        const double efficacy = cutEfficacy(solution);
+        if (efficacy > best_efficacy) {
+          best_efficacy = efficacy;
+          best_delta = initial_best_delta / divisor;
+        }
+      }
+      if (formMirCut(mir_row, best_delta) && addCut(solution, cut_pool))
+        num_cut++;
+    }
+  }
+  clearCut();
+  return num_cut;
+}
+
+bool HighsSeparation::transformMirRow(const int row, const double sign,
+                                      const std::vector<double>& solution,
+                                      MirRow& mir_row) {
+  // Express the row as sum_j a_j x_j <= rhs and substitute each
+  // column by its distance from its lower bound or, if it's closer
+  // (or has no finite lower bound), from its upper bound
+  const HighsLp& mip = *mip_;
+  const double bound = sign > 0 ? mip.rowUpper_[row] : -mip.rowLower_[row];
+  if (highs_isInfinity(bound)) return false;
+  mir_row.col.clear();
+  mir_row.value.clear();
+  mir_row.use_upper.clear();
+  mir_row.rhs = bound;
+  bool has_integer = false;
+  for (int el = ar_start_[row]; el < ar_start_[row + 1]; el++) {
+    const int iCol = ar_index_[el];
+    const double value = sign * ar_value_[el];
+    const double lower = mip.colLower_[iCol];
+    const double upper = mip.colUpper_[iCol];
+    const bool finite_lower = !highs_isInfinity(-lower);
+    const bool finite_upper = !highs_isInfinity(upper);
+    bool use_upper;
+    if (mip.integrality_[iCol]) {
+      has_integer = true;
+      if (finite_lower && finite_upper) {
+        use_upper = upper - solution[iCol] < solution[iCol] - lower;
+      } else {
+        use_upper = finite_upper;
+      }
+    } else {
+      use_upper = !finite_lower;
+    }
+    if (use_upper ? !finite_upper : !finite_lower) return false;
+    mir_row.col.push_back(iCol);
+    mir_row.value.push_back(use_upper ? -value : value);
+    mir_row.use_upper.push_back(use_upper);
+    mir_row.rhs -= value * (use_upper ? upper : lower);
+  }
+  return has_integer;
+}
+
+bool HighsSeparation::formMirCut(const MirRow& mir_row, const double delta) {
+  // Divide the row by delta and apply mixed-integer rounding. Positive
+  // continuous terms are relaxed away and negative ones are scaled by
+  // 1/(delta(1-f)), where f is the fractional part of rhs/delta
+  const HighsLp& mip = *mip_;
+  const double scaled_rhs = mir_row.rhs / delta;
+  const double f = scaled_rhs - std::floor(scaled_rhs);
+  if (f < 0.05 || f > 0.95) return false;
+  clearCut();
+  // The cut is formed as -(sum_j c_j z_j) >= -floor(rhs/delta)
+  cut_lower_ = -std::floor(scaled_rhs);
+  for (int ix = 0; ix < (int)mir_row.col.size(); ix++) {
+    const int iCol = mir_row.col[ix];
+    double coefficient;
+    if (mip.integrality_[iCol]) {
+      const double scaled_value = mir_row.value[ix] / delta;
+      const double fraction = scaled_value - std::floor(scaled_value);
+      coefficient =
+          std::floor(scaled_value) + std::max(0.0, fraction - f) / (1 - f);
+    } else {
+      if (mir_row.value[ix] >= 0) continue;
+      coefficient = mir_row.value[ix] / (delta * (1 - f));
+    }
+    if (coefficient == 0) continue;
+    // Substitute z_j = x_j - l_j or u_j - x_j
+    if (mir_row.use_upper[ix]) {
+      addToCut(iCol, coefficient);
+      cut_lower_ += coefficient * mip.colUpper_[iCol];
+    } else {
+      addToCut(iCol, -coefficient);
+      cut_lower_ -= coefficient * mip.colLower_[iCol];
+    }
+  }
+  return true;
+}
+
+void HighsSeparation::clearCut() {
+  for (int iCol : cut_index_) {
+    cut_value_[iCol] = 0;
+    in_cut_[iCol] = 0;
+  }
+  cut_index_.clear();
+  cut_lower_ = 0;
+}
+
+void HighsSeparation::addToCut(const int col, const double value) {
+  if (!in_cut_[col]) {
+    in_cut_[col] = 1;
+    cut_index_.push_back(col);
+  }
+  cut_value_[col] += value;
+}
+
+double HighsSeparation::cutEfficacy(const std::vector<double>& solution) const {
+  double activity = 0;
+  double norm_squared = 0;
+  for (int iCol : cut_index_) {
+    activity += cut_value_[iCol] * solution[iCol];
+    norm_squared += cut_value_[iCol] * cut_value_[iCol];
+  }
+  if (norm_squared <= 0) return 0;
+  return (cut_lower_ - activity) / std::sqrt(norm_squared);
+}
+
+bool HighsSeparation::addCut(const std::vector<double>& solution,
+                             HighsCutPool& cut_pool) {
+  const HighsLp& mip = *mip_;
+  double max_abs_value = 0;
+  for (int iCol : cut_index_)
+    max_abs_value = std::max(std::fabs(cut_value_[iCol]), max_abs_value);
+  if (max_abs_value <= 0) return false;
+  // Remove tiny coefficients, relaxing the lower bound using the
+  // column bounds
+  std::vector<int> index;
+  std::vector<double> value;
+  double lower = cut_lower_;
+  double min_abs_value = max_abs_value;
+  for (int iCol : cut_index_) {
+    const double cut_value = cut_value_[iCol];
+    if (std::fabs(cut_value) <= cut_small_coefficient * max_abs_value) {
+      const double bound =
+          cut_value > 0 ? mip.colUpper_[iCol] : mip.colLower_[iCol];
+      if (highs_isInfinity(std::fabs(bound))) return false;
+      lower -= cut_value * bound;
+      continue;
+    }
+    min_abs_value = std::min(std::fabs(cut_value), min_abs_value);
+    index.push_back(iCol);
+    value.push_back(cut_value / max_abs_value);
+  }
+  if (max_abs_value > cut_max_dynamism * min_abs_value) return false;
+  lower /= max_abs_value;
+  // Only add the cut if it's efficacious
+  double activity = 0;
+  double norm_squared = 0;
+  for (int ix = 0; ix < (int)index.size(); ix++) {
+    activity += value[ix] * solution[index[ix]];
+    norm_squared += value[ix] * value[ix];
+  }
+  if (lower - activity <= cut_min_efficacy * std::sqrt(norm_squared))
+    return false;
+  return cut_pool.addCut(index, value, lower);
+}
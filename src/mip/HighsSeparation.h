@@ -0,0 +1,81 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef MIP_HIGHS_SEPARATION_H_
+#define MIP_HIGHS_SEPARATION_H_
+
+#include <vector>
+
+#include "Highs.h"
+#include "mip/HighsCutPool.h"
+
+// Separation of cuts from the solution of the LP relaxation of a
+// MIP. Cuts are formed in a dense workspace, cleaned of tiny
+// coefficients, and added to the cut pool if they are efficacious.
+class HighsSeparation {
+ public:
+  void setup(const HighsLp& mip, const double feasibility_tolerance);
+
+  // Gomory mixed-integer cuts from the rows of the optimal tableau of
+  // the LP relaxation in highs, which may contain cuts, for basic
+  // integer columns with fractional values
+  int separateGomory(Highs& highs, HighsCutPool& cut_pool);
+  // Cover cuts from rows of the MIP whose columns are all binary
+  int separateKnapsackCover(const std::vector<double>& solution,
+                            HighsCutPool& cut_pool);
+  // Mixed-integer rounding cuts from single rows of the MIP
+  int separateMir(const std::vector<double>& solution,
+                  HighsCutPool& cut_pool);
+
+ private:
+  struct MirRow {
+    std::vector<int> col;
+    // Coefficients of the columns after shifting them to their
+    // lower bound or complementing them with respect to their upper
+    // bound, and whether the upper bound is used
+    std::vector<double> value;
+    std::vector<int> use_upper;
+    double rhs;
+  };
+  bool transformMirRow(const int row, const double sign,
+                       const std::vector<double>& solution, MirRow& mir_row);
+  bool formMirCut(const MirRow& mir_row, const double delta);
+
+  void clearCut();
+  void addToCut(const int col, const double value);
+  double cutEfficacy(const std::vector<double>& solution) const;
+  bool addCut(const std::vector<double>& solution, HighsCutPool& cut_pool);
+
+  const HighsLp* mip_ = nullptr;
+  double feasibility_tolerance_ = 0;
+
+  // Row-wise copy of the constraint matrix of the MIP
+  std::vector<int> ar_start_;
+  std::vector<int> ar_index_;
+  std::vector<double> ar_value_;
+
+  // The cut sum_j cut_value_[j] x_j >= cut_lower_, held densely
+  std::vector<double> cut_value_;
+  std::vector<int> cut_index_;
+  std::vector<int> in_cut_;
+  double cut_lower_ = 0;
+};
+
+// Gomory cuts are generated from at most gomory_max_num_row tableau
+// rows, whose basic variables have fractional parts at least
+// gomory_min_fraction from an integer. Coefficients smaller than
+// cut_small_coefficient relative to the largest are removed, and
+// cuts whose largest and smallest coefficients differ by a factor of
+// more than cut_max_dynamism are rejected.
+const int gomory_max_num_row = 50;
+const double gomory_min_fraction = 0.01;
+const double cut_small_coefficient = 1e-9;
+const double cut_max_dynamism = 1e6;
+
+#endif
@@ -0,0 +1,91 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsSolutionPool.h"
+
+#include <algorithm>
+#include <cmath>
+
+void HighsSolutionPool::setup(const std::vector<int>& integrality,
+                              const int capacity, const double relative_gap) {
+  integer_col_.clear();
+  for (int col = 0; col < (int)integrality.size(); col++)
+    if (integrality[col]) integer_col_.push_back(col);
+  capacity_ = capacity;
+  relative_gap_ = relative_gap;
+  best_objective_ = HIGHS_CONST_INF;
+  entry_.clear();
+}
+
+bool HighsSolutionPool::add(const std::vector<double>& solution,
+                            const double objective) {
+  if (capacity_ <= 0) return false;
+  // Most solutions offered during the search are rejected here,
+  // before any work proportional to the number of columns is done
+  if ((int)entry_.size() == capacity_ && objective >= entry_.back().objective)
+    return false;
+  if (objective < best_objective_) {
+    best_objective_ = objective;
+    // Remove the solutions that are no longer within the gap
+    const double objective_cutoff = cutoff();
+    while (!entry_.empty() && entry_.back().objective > objective_cutoff)
+      entry_.pop_back();
+  }
+  if (objective > cutoff()) return false;
+
+  const uint64_t hash = hashIntegerValues(solution);
+  for (int index = 0; index < (int)entry_.size(); index++) {
+    Entry& entry = entry_[index];
+    if (entry.hash != hash || !sameIntegerValues(entry.solution, solution))
+      continue;
+    // The solution has the same integer values as one in the pool,
+    // so only replaces it if it has a better objective
+    if (objective >= entry.objective) return false;
+    entry_.erase(entry_.begin() + index);
+    break;
+  }
+
+  Entry entry;
+  entry.objective = objective;
+  entry.hash = hash;
+  entry.solution = solution;
+  std::vector<Entry>::iterator position = std::upper_bound(
+      entry_.begin(), entry_.end(), objective,
+      [](const double value, const Entry& entry) {
+        return value < entry.objective;
+      });
+  entry_.insert(position, std::move(entry));
+  if ((int)entry_.size() > capacity_) entry_.pop_back();
+  return true;
+}
+
+double HighsSolutionPool::cutoff() const {
+  if (relative_gap_ >= HIGHS_CONST_INF) return HIGHS_CONST_INF;
+  return best_objective_ +
+         relative_gap_ * std::max(1.0, std::fabs(best_objective_));
+}
+
+uint64_t HighsSolutionPool::hashIntegerValues(
+    const std::vector<double>& solution) const {
+  // FNV-1a hash of the rounded values of the integer columns
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (int col : integer_col_) {
+    const int64_t value = (int64_t)std::round(solution[col]);
+    hash = (hash ^ (uint64_t)value) * 0x100000001b3ull;
+  }
+  return hash;
+}
+
+bool HighsSolutionPool::sameIntegerValues(
+    const std::vector<double>& solution0,
+    const std::vector<double>& solution1) const {
+  for (int col : integer_col_)
+    if (std::round(solution0[col]) != std::round(solution1[col])) return false;
+  return true;
+}
@@ -0,0 +1,60 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef MIP_HIGHS_SOLUTION_POOL_H_
+#define MIP_HIGHS_SOLUTION_POOL_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "lp_data/HConst.h"
+
+// Pool of the best distinct integer feasible solutions of a MIP, held
+// in increasing order of objective. Solutions are distinct if the
+// values of their integer columns differ, which is checked first by
+// comparing a hash of the values. A solution is only admitted if its
+// objective is within the relative gap of the best objective offered,
+// and if the pool is full it must be better than the worst solution
+// in the pool, which it replaces. Assumes minimization.
+class HighsSolutionPool {
+ public:
+  void setup(const std::vector<int>& integrality, const int capacity,
+             const double relative_gap);
+
+  // Offer a solution to the pool, returning true if it's admitted
+  bool add(const std::vector<double>& solution, const double objective);
+
+  int size() const { return entry_.size(); }
+  double getObjective(const int index) const {
+    return entry_[index].objective;
+  }
+  const std::vector<double>& getSolution(const int index) const {
+    return entry_[index].solution;
+  }
+
+ private:
+  struct Entry {
+    double objective;
+    uint64_t hash;
+    std::vector<double> solution;
+  };
+
+  double cutoff() const;
+  uint64_t hashIntegerValues(const std::vector<double>& solution) const;
+  bool sameIntegerValues(const std::vector<double>& solution0,
+                         const std::vector<double>& solution1) const;
+
+  std::vector<int> integer_col_;
+  int capacity_ = 0;
+  double relative_gap_ = HIGHS_CONST_INF;
+  double best_objective_ = HIGHS_CONST_INF;
+  std::vector<Entry> entry_;
+};
+
+#endif
@@ -0,0 +1,416 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsSymmetry.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <numeric>
+
+void HighsSymmetry::detect(const HighsLp& mip) {
+  mip_ = &mip;
+  num_col_ = mip.numCol_;
+  num_row_ = mip.numRow_;
+  generator_start_.assign(1, 0);
+  generator_col_.clear();
+  generator_image_.clear();
+  log10_group_size_ = 0;
+  work_ = 0;
+  path_colour_.clear();
+  path_num_colour_.clear();
+  path_cell_.clear();
+  path_col_.clear();
+  bool has_integer = false;
+  for (int iCol = 0; iCol < num_col_; iCol++)
+    if (mip.integrality_[iCol]) has_integer = true;
+  if (!has_integer) return;
+  const double num_vertex = num_col_ + num_row_;
+  setupGraph(mip);
+
+  // Follow the first search path, individualizing the first column
+  // in the first cell of columns that isn't a singleton, until the
+  // columns are discrete
+  std::vector<int> colour;
+  int num_colour = refine(colour, initialColour(colour));
+  path_colour_.push_back(colour);
+  path_num_colour_.push_back(num_colour);
+  for (;;) {
+    const int cell = targetCell(colour, num_colour);
+    if (cell < 0) break;
+    if ((path_colour_.size() + 1) * num_vertex > symmetry_max_path_storage ||
+        work_ > symmetry_max_work) {
+      path_colour_.clear();
+      return;
+    }
+    const int col = firstInCell(colour, cell);
+    path_cell_.push_back(cell);
+    path_col_.push_back(col);
+    colour[col] = num_colour;
+    num_colour = refine(colour, num_colour + 1);
+    path_colour_.push_back(colour);
+    path_num_colour_.push_back(num_colour);
+  }
+
+  // From the deepest level up, look for generators that map the
+  // column individualized at the level to each other column in its
+  // cell that isn't already in its orbit. Generators found at deeper
+  // levels fix the columns individualized above them, so the orbit
+  // at each level is that of the stabilizer of the columns above it,
+  // and the group order is the product of the orbit sizes.
+  orbit_parent_.assign(num_col_, -1);
+  const int depth = path_cell_.size();
+  for (int level = depth - 1; level >= 0; level--) {
+    const int col = path_col_[level];
+    const int cell = path_cell_[level];
+    int orbit_size = 1;
+    for (int other = 0; other < num_col_; other++) {
+      if (path_colour_[level][other] != cell || other == col) continue;
+      if (findOrbit(other) != findOrbit(col) && work_ < symmetry_max_work)
+        searchLeaf(level, other);
+      if (findOrbit(other) == findOrbit(col)) orbit_size++;
+    }
+    work_ += num_col_;
+    log10_group_size_ += std::log10((double)orbit_size);
+  }
+  path_colour_.clear();
+  path_colour_.shrink_to_fit();
+}
+
+void HighsSymmetry::getOrbit(const int col,
+                             const std::vector<double>& col_lower,
+                             const std::vector<double>& col_upper,
+                             std::vector<int>& orbit,
+                             std::vector<int>& orbit_parent) const {
+  // A column is its own parent once it's in the union-find
+  orbit.clear();
+  std::vector<int> touched;
+  auto find = [&](int iCol) {
+    while (orbit_parent[iCol] != iCol) iCol = orbit_parent[iCol];
+    return iCol;
+  };
+  auto touch = [&](const int iCol) {
+    if (orbit_parent[iCol] >= 0) return;
+    orbit_parent[iCol] = iCol;
+    touched.push_back(iCol);
+  };
+  for (int gen = 0; gen < numGenerators(); gen++) {
+    bool preserves_bounds = true;
+    for (int el = generator_start_[gen]; el < generator_start_[gen + 1];
+         el++) {
+      const int from = generator_col_[el];
+      const int to = generator_image_[el];
+      if (col_lower[from] != col_lower[to] ||
+          col_upper[from] != col_upper[to]) {
+        preserves_bounds = false;
+        break;
+      }
+    }
+    if (!preserves_bounds) continue;
+    for (int el = generator_start_[gen]; el < generator_start_[gen + 1];
+         el++) {
+      touch(generator_col_[el]);
+      touch(generator_image_[el]);
+      const int from_root = find(generator_col_[el]);
+      const int to_root = find(generator_image_[el]);
+      if (from_root != to_root) orbit_parent[from_root] = to_root;
+    }
+  }
+  if (orbit_parent[col] < 0) {
+    orbit.push_back(col);
+  } else {
+    const int col_root = find(col);
+    for (int iCol : touched)
+      if (find(iCol) == col_root) orbit.push_back(iCol);
+  }
+  for (int iCol : touched) orbit_parent[iCol] = -1;
+}
+
+void HighsSymmetry::setupGraph(const HighsLp& mip) {
+  // Replace the matrix values by their rank among the distinct values
+  const int num_nz = mip.Astart_[num_col_];
+  std::vector<double> value(mip.Avalue_.begin(),
+                            mip.Avalue_.begin() + num_nz);
+  std::sort(value.begin(), value.end());
+  value.erase(std::unique(value.begin(), value.end()), value.end());
+  num_class_ = value.size();
+  a_class_.resize(num_nz);
+  for (int el = 0; el < num_nz; el++)
+    a_class_[el] = std::lower_bound(value.begin(), value.end(),
+                                    mip.Avalue_[el]) -
+                   value.begin();
+  ar_start_.assign(num_row_ + 1, 0);
+  for (int el = 0; el < num_nz; el++) ar_start_[mip.Aindex_[el] + 1]++;
+  for (int iRow = 0; iRow < num_row_; iRow++)
+    ar_start_[iRow + 1] += ar_start_[iRow];
+  ar_index_.resize(num_nz);
+  ar_class_.resize(num_nz);
+  std::vector<int> position(ar_start_.begin(), ar_start_.end() - 1);
+  for (int iCol = 0; iCol < num_col_; iCol++) {
+    for (int el = mip.Astart_[iCol]; el < mip.Astart_[iCol + 1]; el++) {
+      const int ix = position[mip.Aindex_[el]]++;
+      ar_index_[ix] = iCol;
+      ar_class_[ix] = a_class_[el];
+    }
+  }
+}
+
+int HighsSymmetry::initialColour(std::vector<int>& colour) {
+  // Columns are coloured by their cost, bounds and integrality, and
+  // rows by their bounds, with columns and rows never sharing a colour
+  const HighsLp& mip = *mip_;
+  const int num_vertex = num_col_ + num_row_;
+  order_.resize(num_vertex);
+  std::iota(order_.begin(), order_.end(), 0);
+  auto colLess = [&](const int a, const int b) {
+    if (mip.colCost_[a] != mip.colCost_[b])
+      return mip.colCost_[a] < mip.colCost_[b];
+    if (mip.colLower_[a] != mip.colLower_[b])
+      return mip.colLower_[a] < mip.colLower_[b];
+    if (mip.colUpper_[a] != mip.colUpper_[b])
+      return mip.colUpper_[a] < mip.colUpper_[b];
+    return mip.integrality_[a] < mip.integrality_[b];
+  };
+  auto rowLess = [&](const int a, const int b) {
+    if (mip.rowLower_[a] != mip.rowLower_[b])
+      return mip.rowLower_[a] < mip.rowLower_[b];
+    return mip.rowUpper_[a] < mip.rowUpper_[b];
+  };
+  std::sort(order_.begin(), order_.begin() + num_col_, colLess);
+  std::sort(order_.begin() + num_col_, order_.end(),
+            [&](const int a, const int b) {
+              return rowLess(a - num_col_, b - num_col_);
+            });
+  colour.resize(num_vertex);
+  int num_colour = 0;
+  for (int ix = 0; ix < num_vertex; ix++) {
+    const int vertex = order_[ix];
+    if (ix > 0) {
+      const int previous = order_[ix - 1];
+      if (ix == num_col_ ||
+          (ix < num_col_ && colLess(previous, vertex)) ||
+          (ix > num_col_ &&
+           rowLess(previous - num_col_, vertex - num_col_)))
+        num_colour++;
+    }
+    colour[vertex] = num_colour;
+  }
+  return num_vertex > 0 ? num_colour + 1 : 0;
+}
+
+int HighsSymmetry::rankColours(std::vector<int>& colour) {
+  // Replace the colour of each vertex by the rank of its colour and
+  // key, so that the colours are independent of the vertex indices
+  const int num_vertex = colour.size();
+  order_.resize(num_vertex);
+  std::iota(order_.begin(), order_.end(), 0);
+  std::sort(order_.begin(), order_.end(), [&](const int a, const int b) {
+    if (colour[a] != colour[b]) return colour[a] < colour[b];
+    return key_[a] < key_[b];
+  });
+  new_colour_.resize(num_vertex);
+  int num_colour = 0;
+  for (int ix = 0; ix < num_vertex; ix++) {
+    const int vertex = order_[ix];
+    const int previous = ix > 0 ? order_[ix - 1] : vertex;
+    if (colour[vertex] != colour[previous] || key_[vertex] != key_[previous])
+      num_colour++;
+    new_colour_[vertex] = num_colour;
+  }
+  colour.swap(new_colour_);
+  work_ += num_vertex * std::log2(num_vertex + 1.0);
+  return num_vertex > 0 ? num_colour + 1 : 0;
+}
+
+int HighsSymmetry::refine(std::vector<int>& colour, int num_colour) {
+  // Split the vertices of each colour according to the multiset of
+  // colours and matrix values of their edges, until no colour splits
+  const int num_vertex = num_col_ + num_row_;
+  key_.resize(num_vertex);
+  auto hashNeighbours = [&]() {
+    std::sort(neighbour_key_.begin(), neighbour_key_.end());
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (uint64_t key : neighbour_key_) {
+      key ^= key >> 33;
+      key *= 0xff51afd7ed558ccdull;
+      key ^= key >> 33;
+      hash = (hash ^ key) * 0x100000001b3ull;
+    }
+    return hash;
+  };
+  for (;;) {
+    for (int iCol = 0; iCol < num_col_; iCol++) {
+      neighbour_key_.clear();
+      for (int el = mip_->Astart_[iCol]; el < mip_->Astart_[iCol + 1]; el++)
+        neighbour_key_.push_back(
+            (uint64_t)colour[num_col_ + mip_->Aindex_[el]] * num_class_ +
+            a_class_[el]);
+      key_[iCol] = hashNeighbours();
+    }
+    for (int iRow = 0; iRow < num_row_; iRow++) {
+      neighbour_key_.clear();
+      for (int el = ar_start_[iRow]; el < ar_start_[iRow + 1]; el++)
+        neighbour_key_.push_back((uint64_t)colour[ar_index_[el]] * num_class_ +
+                                 ar_class_[el]);
+      key_[num_col_ + iRow] = hashNeighbours();
+    }
+    work_ += 2.0 * ar_start_[num_row_];
+    const int new_num_colour = rankColours(colour);
+    if (new_num_colour == num_colour) break;
+    num_colour = new_num_colour;
+  }
+  return num_colour;
+}
+
+int HighsSymmetry::targetCell(const std::vector<int>& colour,
+                              const int num_colour) {
+  // The cell of columns that isn't a singleton with the least colour,
+  // or -1 if the columns are discrete
+  cell_size_.assign(num_colour, 0);
+  for (int iCol = 0; iCol < num_col_; iCol++) cell_size_[colour[iCol]]++;
+  int cell = -1;
+  for (int iCol = 0; iCol < num_col_; iCol++)
+    if (cell_size_[colour[iCol]] > 1 && (cell < 0 || colour[iCol] < cell))
+      cell = colour[iCol];
+  return cell;
+}
+
+int HighsSymmetry::firstInCell(const std::vector<int>& colour,
+                               const int cell) const {
+  for (int iCol = 0; iCol < num_col_; iCol++)
+    if (colour[iCol] == cell) return iCol;
+  assert(false);
+  return -1;
+}
+
+bool HighsSymmetry::searchLeaf(const int level, const int col) {
+  // Individualize col instead of the column on the first path at
+  // this level, and then follow the first path's rule for choosing
+  // columns. The search is abandoned as soon as the colouring can't
+  // match that of the first path.
+  const int depth = path_cell_.size();
+  std::vector<int> colour = path_colour_[level];
+  colour[col] = path_num_colour_[level];
+  int num_colour = refine(colour, path_num_colour_[level] + 1);
+  for (int next_level = level + 1;; next_level++) {
+    if (num_colour != path_num_colour_[next_level]) return false;
+    if (next_level == depth) break;
+    if (targetCell(colour, num_colour) != path_cell_[next_level] ||
+        work_ > symmetry_max_work)
+      return false;
+    const int next_col = firstInCell(colour, path_cell_[next_level]);
+    colour[next_col] = num_colour;
+    num_colour = refine(colour, num_colour + 1);
+  }
+  return addGenerator(colour);
+}
+
+bool HighsSymmetry::addGenerator(const std::vector<int>& leaf_colour) {
+  // The columns of the two leaves are discrete, so the permutation
+  // maps each column of the first leaf to the column of the same
+  // colour in this leaf. Rows of the same colour are mapped in index
+  // order, which is arbitrary since they have the same bounds and
+  // entries once the columns are discrete.
+  const HighsLp& mip = *mip_;
+  const std::vector<int>& first_colour = path_colour_.back();
+  const int num_colour = path_num_colour_.back();
+  std::vector<int> colour_col(num_colour, -1);
+  for (int iCol = 0; iCol < num_col_; iCol++)
+    colour_col[leaf_colour[iCol]] = iCol;
+  std::vector<int> col_image(num_col_);
+  for (int iCol = 0; iCol < num_col_; iCol++) {
+    col_image[iCol] = colour_col[first_colour[iCol]];
+    if (col_image[iCol] < 0) return false;
+  }
+  std::vector<int> first_order(num_row_);
+  std::vector<int> leaf_order(num_row_);
+  std::iota(first_order.begin(), first_order.end(), 0);
+  std::iota(leaf_order.begin(), leaf_order.end(), 0);
+  auto rowLess = [&](const std::vector<int>& colour, const int a,
+                     const int b) {
+    if (colour[num_col_ + a] != colour[num_col_ + b])
+      return colour[num_col_ + a] < colour[num_col_ + b];
+    return a < b;
+  };
+  std::sort(first_order.begin(), first_order.end(),
+            [&](const int a, const int b) {
+              return rowLess(first_colour, a, b);
+            });
+  std::sort(leaf_order.begin(), leaf_order.end(),
+            [&](const int a, const int b) {
+              return rowLess(leaf_colour, a, b);
+            });
+  std::vector<int> row_image(num_row_);
+  for (int ix = 0; ix < num_row_; ix++) {
+    if (first_colour[num_col_ + first_order[ix]] !=
+        leaf_colour[num_col_ + leaf_order[ix]])
+      return false;
+    row_image[first_order[ix]] = leaf_order[ix];
+  }
+
+  // Check that the permutation is an automorphism of the MIP
+  for (int iCol = 0; iCol < num_col_; iCol++) {
+    const int image = col_image[iCol];
+    if (mip.colCost_[iCol] != mip.colCost_[image] ||
+        mip.colLower_[iCol] != mip.colLower_[image] ||
+        mip.colUpper_[iCol] != mip.colUpper_[image] ||
+        mip.integrality_[iCol] != mip.integrality_[image])
+      return false;
+  }
+  for (int iRow = 0; iRow < num_row_; iRow++) {
+    const int image = row_image[iRow];
+    if (mip.rowLower_[iRow] != mip.rowLower_[image] ||
+        mip.rowUpper_[iRow] != mip.rowUpper_[image])
+      return false;
+  }
+  std::vector<std::pair<int, int>> entry;
+  std::vector<std::pair<int, int>> image_entry;
+  for (int iCol = 0; iCol < num_col_; iCol++) {
+    const int image = col_image[iCol];
+    if (mip.Astart_[iCol + 1] - mip.Astart_[iCol] !=
+        mip.Astart_[image + 1] - mip.Astart_[image])
+      return false;
+    entry.clear();
+    image_entry.clear();
+    for (int el = mip.Astart_[iCol]; el < mip.Astart_[iCol + 1]; el++)
+      entry.push_back(std::make_pair(row_image[mip.Aindex_[el]], a_class_[el]));
+    for (int el = mip.Astart_[image]; el < mip.Astart_[image + 1]; el++)
+      image_entry.push_back(std::make_pair(mip.Aindex_[el], a_class_[el]));
+    std::sort(entry.begin(), entry.end());
+    std::sort(image_entry.begin(), image_entry.end());
+    if (entry != image_entry) return false;
+  }
+  work_ += 2.0 * mip.Astart_[num_col_];
+
+  bool moves_col = false;
+  for (int iCol = 0; iCol < num_col_; iCol++) {
+    if (col_image[iCol] == iCol) continue;
+    moves_col = true;
+    generator_col_.push_back(iCol);
+    generator_image_.push_back(col_image[iCol]);
+    const int from_root = findOrbit(iCol);
+    const int to_root = findOrbit(col_image[iCol]);
+    if (from_root != to_root) orbit_parent_[from_root] = to_root;
+  }
+  if (!moves_col) return false;
+  generator_start_.push_back(generator_col_.size());
+  return true;
+}
+
+int HighsSymmetry::findOrbit(const int col) {
+  int root = col;
+  while (orbit_parent_[root] >= 0) root = orbit_parent_[root];
+  // Compress the path to the root
+  for (int iCol = col; iCol != root;) {
+    const int next = orbit_parent_[iCol];
+    orbit_parent_[iCol] = root;
+    iCol = next;
+  }
+  return root;
+}
@@ -0,0 +1,100 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef MIP_HIGHS_SYMMETRY_H_
+#define MIP_HIGHS_SYMMETRY_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "lp_data/HighsLp.h"
+
+// Symmetries of a MIP: permutations of its columns and rows that map
+// the costs, bounds, integrality and matrix onto themselves. They are
+// found as automorphisms of the coloured bipartite graph of columns
+// and rows, whose edges are coloured by the matrix values. Colour
+// refinement gives an equitable partition of the vertices, and
+// columns in the same cell are individualized along a single search
+// path until the columns are discrete. Each leaf of the search that
+// matches the first leaf gives a permutation, which is kept as a
+// generator if it's an automorphism of the MIP. The search is
+// incomplete, so the group generated may be a subgroup of the
+// symmetry group.
+class HighsSymmetry {
+ public:
+  void detect(const HighsLp& mip);
+
+  int numGenerators() const { return generator_start_.size() - 1; }
+  // Log10 of the order of the group generated, which is exact if the
+  // search finds all the generators that it looks for
+  double log10GroupSize() const { return log10_group_size_; }
+
+  // Get the orbit of a column under the generators that map the
+  // bounds onto themselves. The workspace orbit_parent must be of
+  // size numCol and contain -1 on entry, as it does on exit.
+  void getOrbit(const int col, const std::vector<double>& col_lower,
+                const std::vector<double>& col_upper, std::vector<int>& orbit,
+                std::vector<int>& orbit_parent) const;
+
+ private:
+  void setupGraph(const HighsLp& mip);
+  int initialColour(std::vector<int>& colour);
+  int rankColours(std::vector<int>& colour);
+  int refine(std::vector<int>& colour, int num_colour);
+  int targetCell(const std::vector<int>& colour, const int num_colour);
+  int firstInCell(const std::vector<int>& colour, const int cell) const;
+  bool searchLeaf(const int level, const int col);
+  bool addGenerator(const std::vector<int>& leaf_colour);
+  int findOrbit(const int col);
+
+  const HighsLp* mip_ = nullptr;
+  int num_col_ = 0;
+  int num_row_ = 0;
+  // The matrix values replaced by the rank of their value, held
+  // column-wise and row-wise
+  std::vector<int> a_class_;
+  std::vector<int> ar_start_;
+  std::vector<int> ar_index_;
+  std::vector<int> ar_class_;
+  int num_class_ = 0;
+  double work_ = 0;
+
+  // The first search path: the colours at each level, the number of
+  // colours and the cell containing the column individualized
+  std::vector<std::vector<int>> path_colour_;
+  std::vector<int> path_num_colour_;
+  std::vector<int> path_cell_;
+  std::vector<int> path_col_;
+
+  // Union-find over the columns for the orbits of the generators
+  // found so far
+  std::vector<int> orbit_parent_;
+
+  // The generators, each held as the columns it moves and their
+  // images
+  std::vector<int> generator_start_;
+  std::vector<int> generator_col_;
+  std::vector<int> generator_image_;
+  double log10_group_size_ = 0;
+
+  // Workspace for refinement
+  std::vector<uint64_t> key_;
+  std::vector<uint64_t> neighbour_key_;
+  std::vector<int> order_;
+  std::vector<int> new_colour_;
+  std::vector<int> cell_size_;
+};
+
+// Detection stops when it has done symmetry_max_work operations on
+// nonzeros, and isn't attempted if storing the colours on the first
+// search path would need more than symmetry_max_path_storage entries.
+const double symmetry_max_work = 2e8;
+const double symmetry_max_path_storage = 2e7;
+
+#endif
@@ -9,23 +9,38 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "mip/SolveMip.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "io/HighsIO.h"
 
-// For the moment just return first violated.
-NodeIndex Tree::chooseBranchingVariable(const Node& node) {
+void Tree::setup(const std::vector<int>& integrality,
+                 const std::vector<double>& col_lower,
+                 const std::vector<double>& col_upper) {
+  integer_variables_ = integrality;
+  root_col_lower_ = col_lower;
+  root_col_upper_ = col_upper;
+  pseudocost_.setup(col_lower.size());
+}
+
+// Return the violated column with the best score for the branching
+// rule, or the first violated column for the first fractional rule.
+NodeIndex Tree::chooseBranchingVariable(
+    const std::vector<double>& primal_solution,
+    const std::vector<double>& col_lower,
+    const std::vector<double>& col_upper, const int preferred_col) {
   const double fractional_tolerance = 1e-7;
-  assert(node.integer_variables.size() == node.primal_solution.size());
+  NodeIndex best_col = kNoNodeIndex;
+  double best_score = -1;
+  assert(integer_variables_.size() == primal_solution.size());
 
-  for (int col = 0; col < (int)node.integer_variables.size(); col++) {
-    if (!node.integer_variables[col]) continue;
+  for (int col = 0; col < (int)integer_variables_.size(); col++) {
+    if (!integer_variables_[col]) continue;
 
-    // Get the value, lower and upper bounds for the column. NB Expensive to
-    // store all this on the node
-    const double value = node.primal_solution[col];
-    const double lower = node.col_lower_bound[col];
-    const double upper = node.col_upper_bound[col];
+    // Get the value, lower and upper bounds for the column
+    const double value = primal_solution[col];
+    const double lower = col_lower[col];
+    const double upper = col_upper[col];
     // Don't branch on variables that are at bounds or (mildly) infeasible.
     if (value <= lower + fractional_tolerance) continue;
     if (value >= upper - fractional_tolerance) continue;
@@ -50,26 +65,42 @@ NodeIndex Tree::chooseBranchingVariable(const Node& node) {
               col, fraction_below, 10 * fractional_tolerance);
       }
       // This one is violated.
-      return NodeIndex(col);
+      if (col == preferred_col) return NodeIndex(col);
+      double score;
+      switch (branching_rule_) {
+        case MIP_BRANCHING_RULE_FIRST_FRACTIONAL:
+          return NodeIndex(col);
+        case MIP_BRANCHING_RULE_MOST_FRACTIONAL:
+          score = std::min(fraction_above, fraction_below);
+          break;
+        default:
+          score = pseudocost_.getScore(col, fraction_above);
+          break;
+      }
+      if (score > best_score) {
+        best_score = score;
+        best_col = NodeIndex(col);
+      }
     }
   }
 
-  return kNoNodeIndex;
+  return best_col;
 }
 
-bool Tree::branch(Node& node) {
-  NodeIndex branch_col = chooseBranchingVariable(node);
+bool Tree::branch(Node& node, const std::vector<double>& primal_solution,
+                  const std::vector<double>& col_lower,
+                  const std::vector<double>& col_upper,
+                  const int preferred_col,
+                  const BranchingPenalty& branching_penalty) {
+  NodeIndex branch_col = chooseBranchingVariable(primal_solution, col_lower,
+                                                 col_upper, preferred_col);
   if (branch_col == kNodeIndexError) return false;
 
   if (branch_col == kNoNodeIndex) {
     // All integer variables are feasible. Update best solution if node solution
     // is better. Assuming minimization.
-    const bool better_integer_solution = node.objective_value < best_objective_;
-    num_integer_solutions++;
-    if (better_integer_solution) {
-      best_objective_ = node.objective_value;
-      best_solution_ = node.primal_solution;
-    }
+    const bool better_integer_solution =
+        updateIncumbent(primal_solution, node.objective_value);
     if (mip_report_level > 1) {
       printf("Integer");
       if (better_integer_solution) {
@@ -86,10 +117,24 @@ bool Tree::branch(Node& node) {
   }
 
   int col = static_cast<int>(branch_col);
-  double value = node.primal_solution[col];
+  double value = primal_solution[col];
   const double value_ceil = std::ceil(value);
   const double value_floor = std::floor(value);
 
+  // Estimate the objective degradation required to remove the
+  // integer infeasibilities in the node's solution, other than that
+  // of the branching column, using pseudocosts
+  double other_degradation = 0;
+  for (int iCol = 0; iCol < (int)integer_variables_.size(); iCol++) {
+    if (!integer_variables_[iCol] || iCol == col) continue;
+    const double fraction =
+        primal_solution[iCol] - std::floor(primal_solution[iCol]);
+    if (fraction <= 0) continue;
+    other_degradation +=
+        std::min(pseudocost_.getPseudocost(iCol, false) * fraction,
+                 pseudocost_.getPseudocost(iCol, true) * (1 - fraction));
+  }
+
   if (mip_report_level > 1) {
     /*
       std::cout << "Branching on variable " << col << std::endl
@@ -104,42 +149,198 @@ bool Tree::branch(Node& node) {
   // Create children and add to node.
   num_nodes++;
   node.left_child = std::unique_ptr<Node>(
-      new Node(node.id, node.objective_value, num_nodes, node.level + 1));
+      new Node(&node, node.objective_value, num_nodes, node.level + 1));
   num_nodes++;
   node.right_child = std::unique_ptr<Node>(
-      new Node(node.id, node.objective_value, num_nodes, node.level + 1));
+      new Node(&node, node.objective_value, num_nodes, node.level + 1));
 
-  // Copy bounds from parent and set integer variables.
+  // Record the change in bounds on the branching column
   node.left_child->branch_col = col;
-  node.left_child->col_lower_bound = node.col_lower_bound;
-  node.left_child->col_upper_bound = node.col_upper_bound;
-  node.left_child->col_upper_bound[col] = value_floor;
-  node.left_child->integer_variables = node.integer_variables;
+  node.left_child->branch_col_lower = col_lower[col];
+  node.left_child->branch_col_upper = value_floor;
+  node.left_child->branch_fraction = value - value_floor;
 
   node.right_child->branch_col = col;
-  node.right_child->col_lower_bound = node.col_lower_bound;
-  node.right_child->col_upper_bound = node.col_upper_bound;
-  node.right_child->col_lower_bound[col] = value_ceil;
-  node.right_child->integer_variables = node.integer_variables;
+  node.right_child->branch_col_lower = value_ceil;
+  node.right_child->branch_col_upper = col_upper[col];
+  node.right_child->branch_fraction = value_ceil - value;
+  node.right_child->branch_up = true;
 
-  // Add to stack.
-  std::reference_wrapper<Node> left(*(node.left_child).get());
-  std::reference_wrapper<Node> right(*(node.right_child).get());
-  nodes_.push_back(left);
-  nodes_.push_back(right);
+  if (symmetry_ != nullptr) {
+    // A solution in the down child with a column in the orbit of col
+    // above value_floor is mapped by a symmetry preserving the node's
+    // bounds to one with col above value_floor, which is in the up
+    // child. So the down child can give the orbit the bounds of col.
+    symmetry_->getOrbit(col, col_lower, col_upper, orbit_, orbit_parent_);
+    for (int iCol : orbit_) {
+      if (iCol == col) continue;
+      node.left_child->orbit_col.push_back(iCol);
+      num_orbital_fixed++;
+    }
+  }
+
+  if (branching_penalty) {
+    double down_penalty;
+    double up_penalty;
+    branching_penalty(col, value, down_penalty, up_penalty);
+    node.left_child->lower_bound += down_penalty;
+    node.right_child->lower_bound += up_penalty;
+  }
+
+  node.num_open_child = 2;
+  for (Node* child : {node.left_child.get(), node.right_child.get()}) {
+    child->estimate =
+        std::max(node.objective_value + other_degradation +
+                     pseudocost_.getPseudocost(col, child->branch_up) *
+                         child->branch_fraction,
+                 child->lower_bound);
+    node_queue_.push(*child);
+  }
 
   return true;
 }
 
-double Tree::getBestBound(int& best_node) {
-  int stack_size = nodes_.size();
-  double best_bound = HIGHS_CONST_INF;
-  for (int entry = 0; entry < stack_size; entry++) {
-    Node& node = nodes_[entry];
-    if (node.parent_objective < best_bound) {
-      best_bound = node.parent_objective;
-      best_node = entry;
+bool Tree::updateIncumbent(const std::vector<double>& solution,
+                           const double objective) {
+  num_integer_solutions++;
+  solution_pool_.add(solution, objective);
+  if (objective >= best_objective_) return false;
+  best_objective_ = objective;
+  best_solution_ = solution;
+  return true;
+}
+
+void Tree::getNodeBounds(const Node& node, std::vector<double>& col_lower,
+                         std::vector<double>& col_upper) const {
+  col_lower = root_col_lower_;
+  col_upper = root_col_upper_;
+  // Apply the bound changes from the root down, so that the deepest
+  // change to any column is the one that's used
+  std::vector<const Node*> path;
+  for (const Node* ancestor = &node; ancestor != nullptr;
+       ancestor = ancestor->parent)
+    path.push_back(ancestor);
+  for (int entry = (int)path.size() - 1; entry >= 0; entry--) {
+    const Node& path_node = *path[entry];
+    const int col = path_node.branch_col;
+    if (col >= 0) {
+      col_lower[col] = path_node.branch_col_lower;
+      col_upper[col] = path_node.branch_col_upper;
+    }
+    for (int orbit_col : path_node.orbit_col) {
+      col_lower[orbit_col] = path_node.branch_col_lower;
+      col_upper[orbit_col] = path_node.branch_col_upper;
+    }
+    for (int ix = 0; ix < (int)path_node.implied_col.size(); ix++) {
+      col_lower[path_node.implied_col[ix]] = path_node.implied_col_lower[ix];
+      col_upper[path_node.implied_col[ix]] = path_node.implied_col_upper[ix];
     }
   }
-  return best_bound;
+}
+
+void Tree::getBoundChange(const Node& from_node, const Node& to_node,
+                          std::vector<int>& set, std::vector<double>& col_lower,
+                          std::vector<double>& col_upper,
+                          std::vector<int>& col_set_position) const {
+  set.clear();
+  col_lower.clear();
+  col_upper.clear();
+  // Walk up from the deeper of the two nodes until they meet at
+  // their common ancestor, gathering the columns whose bounds have
+  // been changed on the way. These are the only columns whose bounds
+  // can differ between the two nodes.
+  const Node* from = &from_node;
+  const Node* to = &to_node;
+  auto addCol = [&](const int col) {
+    if (col < 0 || col_set_position[col] >= 0) return;
+    col_set_position[col] = set.size();
+    set.push_back(col);
+    col_lower.push_back(root_col_lower_[col]);
+    col_upper.push_back(root_col_upper_[col]);
+  };
+  while (from != to) {
+    const Node*& deeper = from->level >= to->level ? from : to;
+    addCol(deeper->branch_col);
+    for (int col : deeper->orbit_col) addCol(col);
+    for (int col : deeper->implied_col) addCol(col);
+    deeper = deeper->parent;
+    assert(deeper != nullptr);
+  }
+  if (set.size() > 0) {
+    // Find the bounds at to_node on the columns in the set by
+    // applying the bound changes on the path from the root to
+    // to_node, with the deepest change to any column used
+    std::vector<const Node*> path;
+    for (const Node* ancestor = &to_node; ancestor != nullptr;
+         ancestor = ancestor->parent)
+      path.push_back(ancestor);
+    for (int entry = (int)path.size() - 1; entry >= 0; entry--) {
+      const Node& path_node = *path[entry];
+      const int col = path_node.branch_col;
+      if (col >= 0 && col_set_position[col] >= 0) {
+        col_lower[col_set_position[col]] = path_node.branch_col_lower;
+        col_upper[col_set_position[col]] = path_node.branch_col_upper;
+      }
+      for (int orbit_col : path_node.orbit_col) {
+        const int position = col_set_position[orbit_col];
+        if (position < 0) continue;
+        col_lower[position] = path_node.branch_col_lower;
+        col_upper[position] = path_node.branch_col_upper;
+      }
+      for (int ix = 0; ix < (int)path_node.implied_col.size(); ix++) {
+        const int position = col_set_position[path_node.implied_col[ix]];
+        if (position < 0) continue;
+        col_lower[position] = path_node.implied_col_lower[ix];
+        col_upper[position] = path_node.implied_col_upper[ix];
+      }
+    }
+  }
+  for (int col : set) col_set_position[col] = -1;
+}
+
+void Tree::closeNode(Node& node) {
+  Node* parent = node.parent;
+  if (parent == nullptr) return;
+  assert(parent->num_open_child > 0);
+  parent->num_open_child--;
+  if (parent->num_open_child == 0) parent->basis.clear();
+}
+
+void Tree::restoreNode(Node& root, const HighsCheckpointNode& checkpoint_node,
+                       const HighsPackedBasis* basis) {
+  num_nodes++;
+  std::unique_ptr<Node> bound_node(new Node(
+      &root, root.objective_value, num_nodes, root.level + 1));
+  bound_node->objective_value = checkpoint_node.parent_objective;
+  bound_node->implied_col = checkpoint_node.col;
+  bound_node->implied_col_lower = checkpoint_node.col_lower;
+  bound_node->implied_col_upper = checkpoint_node.col_upper;
+  if (basis != nullptr) bound_node->basis = *basis;
+  bound_node->num_open_child = 1;
+  bound_node->left_child = std::unique_ptr<Node>(
+      new Node(bound_node.get(), checkpoint_node.parent_objective, num_nodes,
+               root.level + 2));
+  Node& node = *bound_node->left_child;
+  node.estimate = checkpoint_node.estimate;
+  node.branch_col = checkpoint_node.branch_col;
+  node.branch_col_lower = checkpoint_node.branch_col_lower;
+  node.branch_col_upper = checkpoint_node.branch_col_upper;
+  node.branch_fraction = checkpoint_node.branch_fraction;
+  node.branch_up = checkpoint_node.branch_up;
+  restored_node_.push_back(std::move(bound_node));
+  node_queue_.push(node);
+}
+
+void Tree::updatePseudocost(const Node& node) {
+  if (node.branch_col < 0 || node.branch_fraction <= 0) return;
+  const double gain = node.objective_value - node.parent_objective;
+  pseudocost_.addObservation(node.branch_col, node.branch_up,
+                             gain / node.branch_fraction);
+}
+
+double Tree::getBestBound(int& best_node) {
+  Node* best_bound_node = node_queue_.getBestBoundNode();
+  if (best_bound_node == nullptr) return HIGHS_CONST_INF;
+  best_node = best_bound_node->id;
+  return best_bound_node->lower_bound;
 }
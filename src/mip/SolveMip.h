@@ -10,6 +10,7 @@
 #ifndef MIP_SOLVEMIP_H_
 #define MIP_SOLVEMIP_H_
 
+#include <atomic>
 #include <cassert>
 #include <functional>
 #include <memory>
@@ -17,6 +18,12 @@
 #include <vector>
 
 #include "lp_data/HConst.h"
+#include "mip/HighsMipCheckpoint.h"
+#include "mip/HighsNodeQueue.h"
+#include "mip/HighsPackedBasis.h"
+#include "mip/HighsPseudocost.h"
+#include "mip/HighsSolutionPool.h"
+#include "mip/HighsSymmetry.h"
 
 struct Node {
   int id;
@@ -25,24 +32,60 @@ struct Node {
   int level;
 
   Node();
-  Node(int parent, double objective, int index, int depth)
+  Node(Node* parent_node, double objective, int index, int depth)
       : id(index),
-        parent_id(parent),
+        parent_id(parent_node == nullptr ? -1 : parent_node->id),
         parent_objective(objective),
-        level(depth) {
+        level(depth),
+        parent(parent_node) {
     left_child = nullptr;
     right_child = nullptr;
     branch_col = -1;
+    branch_fraction = 0;
+    branch_up = false;
+    estimate = objective;
+    lower_bound = objective;
   }
 
-  std::vector<int> integer_variables;
-  std::vector<double> primal_solution;
   double objective_value;
+  // Estimate of the objective value of the best integer solution in
+  // the subtree rooted at the node
+  double estimate;
+  // Lower bound on the objective value of the node LP: the parent's
+  // objective, raised by the branching penalty from the parent's
+  // tableau row of the branching column if it's known
+  double lower_bound;
 
-  // Minimal information about changes. Just col and its bounds for the moment.
+  // Only the change in bounds due to branching is held: the bounds
+  // on branch_col in this node. Bounds on all columns are
+  // reconstructed by walking up the tree to the root.
+  Node* parent;
   int branch_col;
-  std::vector<double> col_lower_bound;
-  std::vector<double> col_upper_bound;
+  double branch_col_lower;
+  double branch_col_upper;
+  // Distance that the parent's LP value for branch_col is moved by
+  // the branching bound, and whether it's moved up
+  double branch_fraction;
+  bool branch_up;
+  // Columns in the orbit of branch_col under the symmetries that
+  // preserve the parent's bounds. Orbital fixing gives them the same
+  // bounds as branch_col in the down child.
+  std::vector<int> orbit_col;
+  // Bound changes implied by domain propagation at the node, applied
+  // after the branching bound change
+  std::vector<int> implied_col;
+  std::vector<double> implied_col_lower;
+  std::vector<double> implied_col_upper;
+
+  // The optimal basis of the node's LP, held while any of its
+  // children remain to be solved, so that they can be warm-started
+  // from it
+  HighsPackedBasis basis;
+  int num_open_child = 0;
+
+  // Position in the node queue
+  bool in_queue = false;
+  int heap_index[2] = {-1, -1};
 
   std::unique_ptr<Node> left_child;
   std::unique_ptr<Node> right_child;
@@ -56,45 +99,164 @@ class Tree {
  public:
   Tree() {}
 
+  void setup(const std::vector<int>& integrality,
+             const std::vector<double>& col_lower,
+             const std::vector<double>& col_upper);
+
+  void setNodeSelection(const int node_selection,
+                        const int best_bound_frequency) {
+    node_queue_.setup(node_selection, best_bound_frequency);
+  }
+
   void pushRootNode(Node& node) {
-    assert(nodes_.size() == 0);
-    std::reference_wrapper<Node> ref(node);
-    nodes_.push_back(ref);
+    assert(node_queue_.empty());
+    node_queue_.push(node);
   }
 
-  Node& getRootNode() {
-    assert(nodes_.size() > 0);
-    return nodes_[0];
+  void setBranchingRule(const int branching_rule) {
+    branching_rule_ = branching_rule;
+  }
+
+  // Use the symmetries of the MIP for orbital fixing when branching
+  void setSymmetry(const HighsSymmetry* symmetry) {
+    symmetry_ = symmetry;
+    orbit_parent_.assign(root_col_lower_.size(), -1);
+  }
+
+  // Branch on a node given its primal solution and the column bounds
+  // used to obtain it. If preferred_col is fractional, it is used.
+  // Given the branching column and its value, branching_penalty
+  // returns lower bounds on the increase in objective for the down
+  // and up children, which are then held as their lower_bound
+  typedef std::function<void(const int col, const double value,
+                             double& down_penalty, double& up_penalty)>
+      BranchingPenalty;
+  bool branch(Node& node, const std::vector<double>& primal_solution,
+              const std::vector<double>& col_lower,
+              const std::vector<double>& col_upper,
+              const int preferred_col = -1,
+              const BranchingPenalty& branching_penalty = nullptr);
+
+  // Get the bounds on all columns at a node
+  void getNodeBounds(const Node& node, std::vector<double>& col_lower,
+                     std::vector<double>& col_upper) const;
+  // Get the set of columns whose bounds differ between from_node and
+  // to_node, together with their bounds at to_node. Only the paths
+  // from the two nodes to their common ancestor are searched for
+  // columns that differ. The workspace col_set_position must be of
+  // size numCol and contain -1 on entry, as it does on exit. It's
+  // passed so that several threads can call this concurrently.
+  void getBoundChange(const Node& from_node, const Node& to_node,
+                      std::vector<int>& set, std::vector<double>& col_lower,
+                      std::vector<double>& col_upper,
+                      std::vector<int>& col_set_position) const;
+
+  // Record that a node has been solved or pruned, and release its
+  // parent's basis if it's no longer needed
+  void closeNode(Node& node);
+
+  // Get the nodes that remain to be solved
+  void getOpenNodes(std::vector<Node*>& nodes) const {
+    node_queue_.getNodes(nodes);
+  }
+  // Add an open node from a checkpoint to the queue. Its bounds that
+  // differ from those at the root are held by a node between it and
+  // the root, together with its parent's basis if there is one.
+  void restoreNode(Node& root, const HighsCheckpointNode& checkpoint_node,
+                   const HighsPackedBasis* basis);
+  // Restore the counts from a checkpoint before its open nodes are
+  // restored
+  void restoreCounts(const int nodes_formed, const int integer_solutions,
+                     const int num_open_node) {
+    num_nodes = nodes_formed - 1 - num_open_node;
+    num_integer_solutions = integer_solutions;
+  }
+  const std::vector<double>& getRootColLower() const {
+    return root_col_lower_;
   }
+  const std::vector<double>& getRootColUpper() const {
+    return root_col_upper_;
+  }
+  HighsPseudocost& getPseudocost() { return pseudocost_; }
 
-  bool branch(Node& node);
+  // Update the pseudocost of the branching column of a node, using
+  // the objective gain relative to its parent
+  void updatePseudocost(const Node& node);
+  // Update a pseudocost using the objective gain from strong branching
+  void addStrongBranchingGain(const int col, const bool up,
+                              const double unit_gain) {
+    pseudocost_.addObservation(col, up, unit_gain);
+  }
+  int getNumPseudocostObservation(const int col) const {
+    return pseudocost_.getNumObservation(col);
+  }
 
-  Node& next() { return nodes_[nodes_.size() - 1]; }
-  void pop() { nodes_.erase(nodes_.end() - 1); }
-  bool empty() { return (nodes_.size() == 0); }
+  // The next node to be solved remains in the queue until pop() is
+  // called
+  Node& next() {
+    if (selected_ == nullptr) selected_ = node_queue_.select();
+    return *selected_;
+  }
+  void pop() {
+    assert(selected_ != nullptr);
+    node_queue_.remove(*selected_);
+    selected_ = nullptr;
+  }
+  bool empty() { return node_queue_.empty(); }
 
+  // Record an integer feasible solution, returning true if it's
+  // better than the best so far. Assumes minimization.
+  bool updateIncumbent(const std::vector<double>& solution,
+                       const double objective);
   const std::vector<double>& getBestSolution() const { return best_solution_; }
+  // Integer feasible solutions are also offered to the solution pool
+  void setupSolutionPool(const int capacity, const double relative_gap) {
+    solution_pool_.setup(integer_variables_, capacity, relative_gap);
+  }
+  const HighsSolutionPool& getSolutionPool() const { return solution_pool_; }
 
-  double getBestObjective() { return best_objective_; }
+  double getBestObjective() { return best_objective_.load(); }
   double getBestBound(int& best_node);
   int getNumIntegerSolutions() { return num_integer_solutions; }
   int getNumNodesFormed() {
     return 1 + num_nodes;
   }  // Root node plus nodes formed by branching
-  int getNumNodesLeft() { return (int)nodes_.size(); }
+  int getNumNodesLeft() { return node_queue_.size(); }
+  int getNumOrbitalFixed() { return num_orbital_fixed; }
   void setMipReportLevel(const int mip_report_level_) {
     mip_report_level = mip_report_level_;
   }
 
  private:
-  std::vector<std::reference_wrapper<Node> > nodes_;
+  HighsNodeQueue node_queue_;
+  Node* selected_ = nullptr;
+  // Nodes holding the bounds of the open nodes from a checkpoint
+  std::vector<std::unique_ptr<Node>> restored_node_;
   std::vector<double> best_solution_;
-  double best_objective_ = HIGHS_CONST_INF;
+  // Atomic so that worker threads can use it for pruning without
+  // synchronisation
+  std::atomic<double> best_objective_{HIGHS_CONST_INF};
+  HighsSolutionPool solution_pool_;
+
+  // Integrality and bounds at the root node
+  std::vector<int> integer_variables_;
+  std::vector<double> root_col_lower_;
+  std::vector<double> root_col_upper_;
+
+  NodeIndex chooseBranchingVariable(const std::vector<double>& primal_solution,
+                                    const std::vector<double>& col_lower,
+                                    const std::vector<double>& col_upper,
+                                    const int preferred_col);
 
-  NodeIndex chooseBranchingVariable(const Node& node);
+  int branching_rule_ = MIP_BRANCHING_RULE_FIRST_FRACTIONAL;
+  HighsPseudocost pseudocost_;
+  const HighsSymmetry* symmetry_ = nullptr;
+  std::vector<int> orbit_;
+  std::vector<int> orbit_parent_;
 
   int num_nodes = 0;
   int num_integer_solutions = 0;
+  int num_orbital_fixed = 0;
   int mip_report_level = 0;
 };
 
@@ -105,7 +105,10 @@ HighsStatus HDual::solve() {
     }
   }
 
+  // Perturb the costs afresh, allowing the perturbation that any
+  // cleanup in a previous solve will have prevented
   initialiseCost(workHMO, 1);
+  simplex_info.allow_cost_perturbation = true;
   assert(simplex_lp_status.has_invert);
   if (!simplex_lp_status.has_invert) {
     HighsLogMessage(workHMO.options_.logfile, HighsMessageType::ERROR,
@@ -143,33 +146,7 @@ HighsStatus HDual::solve() {
 #endif
       if (computeExactDseWeights) {
         // Basis is not logical and DSE weights are to be initialised
-#ifdef HiGHSDEV
-        printf("Compute exact DSE weights\n");
-        analysis->simplexTimerStart(SimplexIzDseWtClock);
-        analysis->simplexTimerStart(DseIzClock);
-#endif
-        for (int i = 0; i < solver_num_row; i++) {
-          row_ep.clear();
-          row_ep.count = 1;
-          row_ep.index[0] = i;
-          row_ep.array[i] = 1;
-          row_ep.packFlag = false;
-          factor->btran(row_ep, analysis->row_ep_density,
-                        analysis->pointer_serial_factor_clocks);
-          dualRHS.workEdWt[i] = row_ep.norm2();
-          const double local_row_ep_density =
-              (double)row_ep.count / solver_num_row;
-          analysis->updateOperationResultDensity(local_row_ep_density,
-                                                 analysis->row_ep_density);
-        }
-#ifdef HiGHSDEV
-        analysis->simplexTimerStop(SimplexIzDseWtClock);
-        analysis->simplexTimerStop(DseIzClock);
-        double IzDseWtTT = analysis->simplexTimerRead(SimplexIzDseWtClock);
-        HighsPrintMessage(options.output, options.message_level, ML_DETAILED,
-                          "Computed %d initial DSE weights in %gs\n",
-                          solver_num_row, IzDseWtTT);
-#endif
+        computeInitialDualSteepestEdgeWeights();
       }
 #ifdef HiGHSDEV
       else {
@@ -404,6 +381,7 @@ void HDual::init() {
 
   // Copy pointers
   jMove = &workHMO.simplex_basis_.nonbasicMove_[0];
+  nonbasicFlag = &workHMO.simplex_basis_.nonbasicFlag_[0];
   workDual = &workHMO.simplex_info_.workDual_[0];
   workValue = &workHMO.simplex_info_.workValue_[0];
   workRange = &workHMO.simplex_info_.workRange_[0];
@@ -415,12 +393,14 @@ void HDual::init() {
   Tp = primal_feasibility_tolerance;
   Td = dual_feasibility_tolerance;
 
-  // Setup local vectors
-  col_DSE.setup(solver_num_row);
-  col_BFRT.setup(solver_num_row);
-  col_aq.setup(solver_num_row);
-  row_ep.setup(solver_num_row);
-  row_ap.setup(solver_num_col);
+  // Setup local vectors, taking their storage from the pool
+  HVectorPool& pool = workHMO.hvector_pool_;
+  pool.acquire(col_DSE, solver_num_row);
+  pool.acquire(col_BFRT, solver_num_row);
+  pool.acquire(col_aq, solver_num_row);
+  pool.acquire(row_ep, solver_num_row);
+  pool.acquire(row_ap, solver_num_col);
+  work_vectors_from_pool = true;
   // Setup other buffers
   dualRow.setup();
   dualRHS.setup();
@@ -943,6 +923,16 @@ void HDual::rebuild() {
   //
   analysis->simplexTimerStart(ComputeDuObjClock);
   computeDualObjectiveValue(workHMO, solvePhase);
+  // Correct any drift in the updated contribution of the cost
+  // perturbations to the dual objective value, which is only needed
+  // to test a bound on the dual objective value in phase 2
+  track_dual_objective_perturbation =
+      solvePhase == SOLVE_PHASE_2 &&
+      workHMO.lp_.sense_ == ObjSense::MINIMIZE &&
+      workHMO.options_.dual_objective_value_upper_bound < HIGHS_CONST_INF &&
+      simplex_info.simplex_strategy != SIMPLEX_STRATEGY_DUAL_MULTI;
+  if (track_dual_objective_perturbation)
+    dual_objective_perturbation = computeDualObjectivePerturbation();
   analysis->simplexTimerStop(ComputeDuObjClock);
 
   if (check_updated_objective_value) {
@@ -970,6 +960,10 @@ void HDual::rebuild() {
     }
     reportRebuild(rebuild_invert_hint);
   }
+  // Possibly call the user callback. Any interrupt is picked up by
+  // bailoutOnTimeIterations()
+  if (workHMO.callback_.active())
+    simplexRebuildCallback(workHMO, simplex_info.updated_dual_objective_value);
 
   build_syntheticTick = factor->build_syntheticTick;
   total_syntheticTick = 0;
@@ -1019,6 +1013,8 @@ void HDual::cleanup() {
   // Compute the dual objective value
   analysis->simplexTimerStart(ComputeDuObjClock);
   computeDualObjectiveValue(workHMO, solvePhase);
+  if (track_dual_objective_perturbation)
+    dual_objective_perturbation = computeDualObjectivePerturbation();
   analysis->simplexTimerStop(ComputeDuObjClock);
   // Now that there's a new dual_objective_value, reset the updated
   // value
@@ -1205,11 +1201,65 @@ void HDual::iterationAnalysis() {
     }
   }
 
+  // Record any degenerate iteration and, if the dual simplex is
+  // stalling, possibly re-perturb the costs. A dual step no larger
+  // than the cost perturbation only moves between perturbed ties, so
+  // is degenerate
+  const HighsSimplexInfo& simplex_info = workHMO.simplex_info_;
+  if (analysis->stalling(workHMO.iteration_counts_,
+                         simplex_info.max_cost_perturbation)) {
+    if (simplex_info.perturbation_strategy ==
+            SIMPLEX_PERTURBATION_STRATEGY_ADAPTIVE &&
+        simplex_info.allow_cost_perturbation &&
+        num_cost_reperturbation < max_num_cost_reperturbation)
+      reperturbCosts();
+    analysis->resetStall();
+  }
+
 #ifdef HiGHSDEV
   analysis->iterationRecord();
 #endif
 }
 
+void HDual::reperturbCosts() {
+  // Break ties between the zero (or tiny) reduced costs which cause
+  // the dual simplex to stall by perturbing the cost of each
+  // nonbasic variable in the direction that keeps its dual
+  // feasible. Since the costs of basic variables are unchanged, so
+  // are the duals of all other variables. The perturbation is
+  // removed with any other cost perturbation when the dual simplex
+  // terminates.
+  HighsSimplexInfo& simplex_info = workHMO.simplex_info_;
+  HighsRandom& random = workHMO.random_;
+  const double base =
+      5e-7 * simplex_info.dual_simplex_cost_perturbation_multiplier;
+  double dual_objective_value_change = 0;
+  for (int iVar = 0; iVar < solver_num_tot; iVar++) {
+    if (!nonbasicFlag[iVar]) continue;
+    const int move = jMove[iVar];
+    // Fixed and free nonbasic variables have no move
+    if (!move) continue;
+    const double perturbation =
+        move * (fabs(simplex_info.workCost_[iVar]) + 1) * base *
+        (1 + random.fraction());
+    simplex_info.workCost_[iVar] += perturbation;
+    workDual[iVar] += perturbation;
+    simplex_info.max_cost_perturbation =
+        max(fabs(perturbation), simplex_info.max_cost_perturbation);
+    dual_objective_value_change += workValue[iVar] * perturbation;
+  }
+  simplex_info.updated_dual_objective_value += dual_objective_value_change;
+  if (track_dual_objective_perturbation)
+    dual_objective_perturbation += dual_objective_value_change;
+  simplex_info.costs_perturbed = 1;
+  num_cost_reperturbation++;
+  workHMO.iteration_counts_.simplex_reperturbation++;
+  HighsPrintMessage(workHMO.options_.output, workHMO.options_.message_level,
+                    ML_DETAILED,
+                    "Dual simplex stalling: re-perturbing costs (%d)\n",
+                    num_cost_reperturbation);
+}
+
 void HDual::reportRebuild(const int rebuild_invert_hint) {
   analysis->simplexTimerStart(ReportRebuildClock);
   iterationAnalysisData();
@@ -1629,6 +1679,12 @@ void HDual::updateFtranBFRT() {
 
   debugUpdatedObjectiveValue(workHMO, algorithm, solvePhase,
                              "Before update_flip");
+  if (track_dual_objective_perturbation) {
+    for (int i = 0; i < dualRow.workCount; i++)
+      dual_objective_perturbation +=
+          costPerturbation(dualRow.workData[i].first) *
+          dualRow.workData[i].second;
+  }
   dualRow.updateFlip(&col_BFRT);
   debugUpdatedObjectiveValue(workHMO, algorithm, solvePhase,
                              "After  update_flip");
@@ -1711,6 +1767,8 @@ void HDual::updateDual() {
     // Little to do if thetaDual is zero
     debugUpdatedObjectiveValue(workHMO, algorithm, solvePhase,
                                "Before shift_cost");
+    if (track_dual_objective_perturbation)
+      dual_objective_perturbation -= workDual[columnIn] * workValue[columnIn];
     shift_cost(workHMO, columnIn, -workDual[columnIn]);
     debugUpdatedObjectiveValue(workHMO, algorithm, solvePhase,
                                "After shift_cost");
@@ -1758,6 +1816,9 @@ void HDual::updateDual() {
 
   debugUpdatedObjectiveValue(workHMO, algorithm, solvePhase,
                              "Before shift_back");
+  if (track_dual_objective_perturbation)
+    dual_objective_perturbation -=
+        workHMO.simplex_info_.workShift_[columnOut] * baseValue[rowOut];
   shift_back(workHMO, columnOut);
   debugUpdatedObjectiveValue(workHMO, algorithm, solvePhase,
                              "After shift_back");
@@ -1777,12 +1838,14 @@ void HDual::updatePrimal(HVector* DSE_Vector) {
   // steepest edge weights) or row_ep = B^{-T}e_p.
   //
   // Update - primal and weight
+  updateDualObjectivePerturbation(col_BFRT, 1);
   dualRHS.updatePrimal(&col_BFRT, 1);
   dualRHS.updateInfeasList(&col_BFRT);
   double x_out = baseValue[rowOut];
   double l_out = baseLower[rowOut];
   double u_out = baseUpper[rowOut];
   thetaPrimal = (x_out - (deltaPrimal < 0 ? l_out : u_out)) / alpha;
+  updateDualObjectivePerturbation(col_aq, thetaPrimal);
   dualRHS.updatePrimal(&col_aq, thetaPrimal);
   if (dual_edge_weight_mode == DualEdgeWeightMode::STEEPEST_EDGE) {
     const double new_pivotal_edge_weight =
@@ -1839,6 +1902,7 @@ void HDual::updatePivots() {
   // Update the sets of indices of basic and nonbasic variables
   debugUpdatedObjectiveValue(workHMO, algorithm, solvePhase,
                              "Before update_pivots");
+  const double columnOut_value = baseValue[rowOut];
   update_pivots(workHMO, columnIn, rowOut, sourceOut);
   debugUpdatedObjectiveValue(workHMO, algorithm, solvePhase,
                              "After update_pivots");
@@ -1863,6 +1927,12 @@ void HDual::updatePivots() {
   // dualRHS.work_infeasibility
   dualRHS.updatePivots(
       rowOut, workHMO.simplex_info_.workValue_[columnIn] + thetaPrimal);
+  // The leaving variable is now at a bound and the entering variable
+  // has moved by thetaPrimal
+  if (track_dual_objective_perturbation)
+    dual_objective_perturbation +=
+        costPerturbation(columnOut) * (workValue[columnOut] - columnOut_value) +
+        costPerturbation(columnIn) * thetaPrimal;
   // Determine whether to reinvert based on the synthetic clock
   bool reinvert_syntheticClock = total_syntheticTick >= build_syntheticTick;
   const bool performed_min_updates =
@@ -1910,6 +1980,95 @@ void HDual::initialiseDevexFramework(const bool parallel) {
   analysis->simplexTimerStop(DevexIzClock);
 }
 
+void HDual::computeInitialDualSteepestEdgeWeights() {
+  // Compute the initial DSE weights as the squared 2-norms of the
+  // rows of B^{-1}. Each requires a BTRAN but, since these are
+  // independent and HFactor::btran is const, they are performed in
+  // parallel, with each thread using its own HVector.
+  //
+  // If approximate_initial_DSE_weights is set then only a sample of
+  // the weights is computed, and the remaining weights are set to the
+  // average of the sample. These are refined as the solve proceeds
+  // since the weight of each row chosen by CHUZR is computed exactly
+  // and, if it is not acceptably accurate, CHUZR is repeated.
+  HighsOptions& options = workHMO.options_;
+  HighsTimer& timer = workHMO.timer_;
+#ifdef HiGHSDEV
+  printf("Compute exact DSE weights\n");
+  analysis->simplexTimerStart(SimplexIzDseWtClock);
+  analysis->simplexTimerStart(DseIzClock);
+#endif
+  const double start_time = timer.readRunHighsClock();
+  // Determine the rows whose weight is to be computed: every row, or
+  // every sample_stride-th row
+  int sample_stride = 1;
+  if (options.approximate_initial_DSE_weights &&
+      solver_num_row > min_approximate_DSE_weight_num_row)
+    sample_stride = solver_num_row / approximate_DSE_weight_sample_size;
+  const int num_computed = (solver_num_row + sample_stride - 1) / sample_stride;
+
+  int num_threads = 1;
+#ifdef OPENMP
+  // There is no point in using more threads than there are BTRANs to
+  // perform in (reasonably) sized batches
+  num_threads = omp_get_max_threads();
+  num_threads = min(num_threads, options.highs_max_threads);
+  num_threads = min(num_threads, num_computed / dse_weight_btran_batch_size);
+  num_threads = max(num_threads, 1);
+#endif
+  // Each thread needs its own HVector for BTRAN, the first of which
+  // is row_ep
+  vector<HVector> thread_row_ep(num_threads - 1);
+  for (HVector& thread_ep : thread_row_ep) thread_ep.setup(solver_num_row);
+
+  const double historical_density = analysis->row_ep_density;
+  double sum_computed_weight = 0;
+  double sum_row_ep_density = 0;
+#pragma omp parallel for num_threads(num_threads) schedule( \
+    dynamic, dse_weight_btran_batch_size) reduction(+ : sum_computed_weight, \
+                                                        sum_row_ep_density)
+  for (int iSample = 0; iSample < num_computed; iSample++) {
+    int thread_id = 0;
+#ifdef OPENMP
+    thread_id = omp_get_thread_num();
+#endif
+    HVector& work_ep = thread_id == 0 ? row_ep : thread_row_ep[thread_id - 1];
+    const int iRow = iSample * sample_stride;
+    work_ep.clear();
+    work_ep.count = 1;
+    work_ep.index[0] = iRow;
+    work_ep.array[iRow] = 1;
+    work_ep.packFlag = false;
+    factor->btran(work_ep, historical_density,
+                  analysis->getThreadFactorTimerClockPointer());
+    const double weight = work_ep.norm2();
+    dualRHS.workEdWt[iRow] = weight;
+    sum_computed_weight += weight;
+    sum_row_ep_density += (double)work_ep.count / solver_num_row;
+  }
+  // Since updateOperationResultDensity isn't thread safe, it's called
+  // once with the average density of the BTRAN results
+  analysis->updateOperationResultDensity(sum_row_ep_density / num_computed,
+                                         analysis->row_ep_density);
+  if (sample_stride > 1) {
+    // Set the weights that have not been computed to the average of
+    // those that have been
+    const double average_weight =
+        max(sum_computed_weight / num_computed, 1.0);
+    for (int iRow = 0; iRow < solver_num_row; iRow++)
+      if (iRow % sample_stride) dualRHS.workEdWt[iRow] = average_weight;
+  }
+  const double IzDseWtTT = timer.readRunHighsClock() - start_time;
+#ifdef HiGHSDEV
+  analysis->simplexTimerStop(SimplexIzDseWtClock);
+  analysis->simplexTimerStop(DseIzClock);
+#endif
+  HighsPrintMessage(options.output, options.message_level, ML_DETAILED,
+                    "Computed %d initial DSE weights (of %d) using %d "
+                    "thread(s) in %gs\n",
+                    num_computed, solver_num_row, num_threads, IzDseWtTT);
+}
+
 void HDual::interpretDualEdgeWeightStrategy(
     const int dual_edge_weight_strategy) {
   if (dual_edge_weight_strategy == SIMPLEX_DUAL_EDGE_WEIGHT_STRATEGY_CHOOSE) {
@@ -2268,6 +2427,8 @@ bool HDual::bailoutReturn() {
                HighsModelStatus::REACHED_TIME_LIMIT ||
            workHMO.scaled_model_status_ ==
                HighsModelStatus::REACHED_ITERATION_LIMIT ||
+           workHMO.scaled_model_status_ ==
+               HighsModelStatus::REACHED_INTERRUPT ||
            workHMO.scaled_model_status_ ==
                HighsModelStatus::REACHED_DUAL_OBJECTIVE_VALUE_UPPER_BOUND);
   }
@@ -2281,6 +2442,7 @@ bool HDual::bailoutOnTimeIterations() {
     // reasons
     assert(scaled_model_status == HighsModelStatus::REACHED_TIME_LIMIT ||
            scaled_model_status == HighsModelStatus::REACHED_ITERATION_LIMIT ||
+           scaled_model_status == HighsModelStatus::REACHED_INTERRUPT ||
            scaled_model_status ==
                HighsModelStatus::REACHED_DUAL_OBJECTIVE_VALUE_UPPER_BOUND);
   } else if (workHMO.timer_.readRunHighsClock() > workHMO.options_.time_limit) {
@@ -2290,6 +2452,9 @@ bool HDual::bailoutOnTimeIterations() {
              workHMO.options_.simplex_iteration_limit) {
     solve_bailout = true;
     scaled_model_status = HighsModelStatus::REACHED_ITERATION_LIMIT;
+  } else if (workHMO.callback_.interruptRequested()) {
+    solve_bailout = true;
+    scaled_model_status = HighsModelStatus::REACHED_INTERRUPT;
   }
   return solve_bailout;
 }
@@ -2302,84 +2467,145 @@ bool HDual::bailoutOnDualObjective() {
                HighsModelStatus::REACHED_TIME_LIMIT ||
            workHMO.scaled_model_status_ ==
                HighsModelStatus::REACHED_ITERATION_LIMIT ||
+           workHMO.scaled_model_status_ ==
+               HighsModelStatus::REACHED_INTERRUPT ||
            workHMO.scaled_model_status_ ==
                HighsModelStatus::REACHED_DUAL_OBJECTIVE_VALUE_UPPER_BOUND);
   } else if (workHMO.lp_.sense_ == ObjSense::MINIMIZE &&
-             solvePhase == SOLVE_PHASE_2) {
-    if (workHMO.simplex_info_.updated_dual_objective_value >
-        workHMO.options_.dual_objective_value_upper_bound)
+             solvePhase == SOLVE_PHASE_2 && !invertHint &&
+             workHMO.options_.dual_objective_value_upper_bound <
+                 HIGHS_CONST_INF) {
+    // If the contribution of the cost perturbations is being tracked,
+    // the exact dual objective value is tested every iteration.
+    // Otherwise, it is only computed once the updated value exceeds
+    // the bound
+    analysis->simplexTimerStart(IterateDuObjBoundClock);
+    if (track_dual_objective_perturbation ||
+        workHMO.simplex_info_.updated_dual_objective_value >
+            workHMO.options_.dual_objective_value_upper_bound)
       solve_bailout = reachedExactDualObjectiveValueUpperBound();
+    analysis->simplexTimerStop(IterateDuObjBoundClock);
   }
   return solve_bailout;
 }
 
 bool HDual::reachedExactDualObjectiveValueUpperBound() {
-  // Solving a minimization in dual simplex phase 2, and dual
-  // objective exceeds the prescribed upper bound. However, costs
+  // Solving a minimization in dual simplex phase 2, and the dual
+  // objective may exceed the prescribed upper bound. However, costs
   // will be perturbed, so need to check whether exact dual
-  // objective value exceeds the prescribed upper bound. This can be
-  // a relatively expensive calculation, so determine whether to do
-  // it according to the sparsity of the pivotal row
+  // objective value exceeds the prescribed upper bound. This is
+  // obtained from the updated dual objective value by removing the
+  // contribution of the perturbations, which is either known or
+  // computed without any solves
   bool reached_exact_dual_objective_value_upper_bound = false;
-  double use_row_ap_density =
-      std::min(std::max(analysis->row_ap_density, 0.01), 1.0);
-  int check_frequency = 1.0 / use_row_ap_density;
-  assert(check_frequency > 0);
-
-  bool check_exact_dual_objective_value =
-      workHMO.simplex_info_.update_count % check_frequency == 0;
-
-  if (check_exact_dual_objective_value) {
-    const double dual_objective_value_upper_bound =
-        workHMO.options_.dual_objective_value_upper_bound;
-    const double perturbed_dual_objective_value =
-        workHMO.simplex_info_.updated_dual_objective_value;
-    const double perturbed_value_residual =
-        perturbed_dual_objective_value - dual_objective_value_upper_bound;
-    const double exact_dual_objective_value = computeExactDualObjectiveValue();
-    const double exact_value_residual =
-        exact_dual_objective_value - dual_objective_value_upper_bound;
-    std::string action;
-    if (exact_dual_objective_value > dual_objective_value_upper_bound) {
+  const double dual_objective_value_upper_bound =
+      workHMO.options_.dual_objective_value_upper_bound;
+  const double perturbation = track_dual_objective_perturbation
+                                  ? dual_objective_perturbation
+                                  : computeDualObjectivePerturbation();
+  const double exact_dual_objective_value =
+      workHMO.simplex_info_.updated_dual_objective_value -
+      perturbation * workHMO.scale_.cost_;
+  if (workHMO.options_.highs_debug_level > HIGHS_DEBUG_LEVEL_CHEAP) {
+    // Check against the value computed from the exact duals
+    const double computed_exact_dual_objective_value =
+        computeExactDualObjectiveValue();
+    const double difference = fabs(exact_dual_objective_value -
+                                   computed_exact_dual_objective_value);
+    if (difference >
+        1e-6 * std::max(1.0, fabs(computed_exact_dual_objective_value)))
+      HighsLogMessage(workHMO.options_.logfile, HighsMessageType::WARNING,
+                      "Exact dual objective value on iteration %d is %g, "
+                      "but %g when computed from the exact duals",
+                      workHMO.iteration_counts_.simplex,
+                      exact_dual_objective_value,
+                      computed_exact_dual_objective_value);
+  }
+  if (exact_dual_objective_value > dual_objective_value_upper_bound) {
 #ifdef SCIP_DEV
-      printf("HDual::solvePhase2: %12g = Objective > ObjectiveUB\n",
-             workHMO.simplex_info_.updated_dual_objective_value,
-             dual_objective_value_upper_bound);
+    printf("HDual::solvePhase2: %12g = Objective > ObjectiveUB\n",
+           workHMO.simplex_info_.updated_dual_objective_value,
+           dual_objective_value_upper_bound);
 #endif
-      action = "Have DualUB bailout";
-      reached_exact_dual_objective_value_upper_bound = true;
-      workHMO.scaled_model_status_ =
-          HighsModelStatus::REACHED_DUAL_OBJECTIVE_VALUE_UPPER_BOUND;
-    } else {
-      action = "No   DualUB bailout";
-    }
+    reached_exact_dual_objective_value_upper_bound = true;
+    workHMO.scaled_model_status_ =
+        HighsModelStatus::REACHED_DUAL_OBJECTIVE_VALUE_UPPER_BOUND;
     HighsLogMessage(workHMO.options_.logfile, HighsMessageType::INFO,
-                    "%s on iteration %d: Density %11.4g; Frequency %d: "
+                    "Have DualUB bailout on iteration %d: "
                     "Residual(Perturbed = %g; Exact = %g)",
-                    action.c_str(), workHMO.iteration_counts_.simplex,
-                    use_row_ap_density, check_frequency,
-                    perturbed_value_residual, exact_value_residual);
+                    workHMO.iteration_counts_.simplex,
+                    workHMO.simplex_info_.updated_dual_objective_value -
+                        dual_objective_value_upper_bound,
+                    exact_dual_objective_value -
+                        dual_objective_value_upper_bound);
   }
   return reached_exact_dual_objective_value_upper_bound;
 }
 
+double HDual::computeDualObjectivePerturbation() {
+  // For any basis, the dual objective value is the objective value
+  // of its primal solution, so the contribution of perturbing (and
+  // shifting) the costs is the sum over all variables of the
+  // perturbation times the value of the variable
+  const int* basicIndex = &workHMO.simplex_basis_.basicIndex_[0];
+  double perturbation = 0;
+  for (int iVar = 0; iVar < solver_num_tot; iVar++) {
+    if (!nonbasicFlag[iVar]) continue;
+    const double cost_perturbation = costPerturbation(iVar);
+    if (cost_perturbation) perturbation += cost_perturbation * workValue[iVar];
+  }
+  for (int iRow = 0; iRow < solver_num_row; iRow++) {
+    const double cost_perturbation = costPerturbation(basicIndex[iRow]);
+    if (cost_perturbation) perturbation += cost_perturbation * baseValue[iRow];
+  }
+  return perturbation;
+}
+
+double HDual::costPerturbation(const int iVar) const {
+  const HighsSimplexInfo& simplex_info = workHMO.simplex_info_;
+  double cost_perturbation =
+      simplex_info.workCost_[iVar] + simplex_info.workShift_[iVar];
+  if (iVar < solver_num_col)
+    cost_perturbation -=
+        (int)workHMO.simplex_lp_.sense_ * workHMO.simplex_lp_.colCost_[iVar];
+  return cost_perturbation;
+}
+
+void HDual::updateDualObjectivePerturbation(const HVector& column,
+                                            const double theta) {
+  if (!track_dual_objective_perturbation || !theta) return;
+  const int* basicIndex = &workHMO.simplex_basis_.basicIndex_[0];
+  const double* columnArray = &column.array[0];
+  double change = 0;
+  if (column.count < 0 || column.count > 0.4 * solver_num_row) {
+    for (int iRow = 0; iRow < solver_num_row; iRow++)
+      if (columnArray[iRow])
+        change += costPerturbation(basicIndex[iRow]) * columnArray[iRow];
+  } else {
+    for (int i = 0; i < column.count; i++) {
+      const int iRow = column.index[i];
+      change += costPerturbation(basicIndex[iRow]) * columnArray[iRow];
+    }
+  }
+  dual_objective_perturbation -= theta * change;
+}
+
 double HDual::computeExactDualObjectiveValue() {
   const HighsLp& simplex_lp = workHMO.simplex_lp_;
   const SimplexBasis& simplex_basis = workHMO.simplex_basis_;
   const HighsSimplexInfo& simplex_info = workHMO.simplex_info_;
   HMatrix& matrix = workHMO.matrix_;
   HFactor& factor = workHMO.factor_;
+  HVectorPool& pool = workHMO.hvector_pool_;
   // Create a local buffer for the pi vector
   HVector dual_col;
-  dual_col.setup(simplex_lp.numRow_);
-  dual_col.clear();
+  pool.acquire(dual_col, simplex_lp.numRow_);
   for (int iRow = 0; iRow < simplex_lp.numRow_; iRow++) {
     int iVar = simplex_basis.basicIndex_[iRow];
     if (iVar < simplex_lp.numCol_) {
       const double value = simplex_lp.colCost_[iVar];
       if (value) {
-        dual_col.count++;
-        dual_col.index[iRow] = iRow;
+        dual_col.index[dual_col.count++] = iRow;
         dual_col.array[iRow] = value;
       }
     }
@@ -2387,8 +2613,7 @@ double HDual::computeExactDualObjectiveValue() {
   // Create a local buffer for the dual vector
   const int numTot = simplex_lp.numCol_ + simplex_lp.numRow_;
   HVector dual_row;
-  dual_row.setup(simplex_lp.numCol_);
-  dual_row.clear();
+  pool.acquire(dual_row, simplex_lp.numCol_);
   if (dual_col.count) {
     const double NoDensity = 1;
     factor.btran(dual_col, NoDensity);
@@ -2430,5 +2655,7 @@ double HDual::computeExactDualObjectiveValue() {
         workHMO.options_.logfile, HighsMessageType::WARNING,
         "||exact dual vector|| = %g; ||delta dual vector|| = %g: ratio = %g",
         norm_dual, norm_delta_dual, relative_delta);
+  pool.release(dual_col);
+  pool.release(dual_row);
   return dual_objective;
 }
@@ -73,6 +73,19 @@ class HDual {
     dualRHS.setup();
   }
 
+  ~HDual() {
+    // Return the work vectors to the pool so that they can be reused
+    // by subsequent solves
+    if (work_vectors_from_pool) {
+      HVectorPool& pool = workHMO.hvector_pool_;
+      pool.release(row_ep);
+      pool.release(row_ap);
+      pool.release(col_aq);
+      pool.release(col_BFRT);
+      pool.release(col_DSE);
+    }
+  }
+
   /**
    * @brief Solve a model instance
    */
@@ -278,6 +291,20 @@ class HDual {
    */
   void initialiseDevexFramework(const bool parallel = false);
 
+  /**
+   * @brief Compute the initial dual steepest edge weights by
+   * performing a BTRAN for each row, in parallel if possible. Only
+   * a sample of the weights is computed if the option
+   * approximate_initial_DSE_weights is set
+   */
+  void computeInitialDualSteepestEdgeWeights();
+
+  /**
+   * @brief Perturb the costs of nonbasic variables to break the ties
+   * which cause the dual simplex to stall
+   */
+  void reperturbCosts();
+
   /**
    * @brief Interpret the dual edge weight strategy as setting of a mode and
    * other actions
@@ -286,6 +313,23 @@ class HDual {
       const int simplex_dual_edge_weight_strategy);
 
   bool reachedExactDualObjectiveValueUpperBound();
+  /**
+   * @brief Contribution of the cost perturbations and shifts to the
+   * dual objective value, computed from scratch
+   */
+  double computeDualObjectivePerturbation();
+  /**
+   * @brief Amount by which the cost of a variable is perturbed or
+   * shifted
+   */
+  double costPerturbation(const int iVar) const;
+  /**
+   * @brief Update the contribution of the cost perturbations and
+   * shifts to the dual objective value when the basic primal values
+   * are reduced by theta times a column
+   */
+  void updateDualObjectivePerturbation(const HVector& column,
+                                       const double theta);
   double computeExactDualObjectiveValue();
 
   /**
@@ -434,6 +478,11 @@ class HDual {
   bool allow_dual_steepest_edge_to_devex_switch;
 
   const double min_dual_steepest_edge_weight = 1e-4;
+  // Number of consecutive initial DSE weight BTRANs assigned to a
+  // thread, and parameters for approximate initial DSE weights
+  const int dse_weight_btran_batch_size = 64;
+  const int min_approximate_DSE_weight_num_row = 10000;
+  const int approximate_DSE_weight_sample_size = 1000;
 
   double Tp;  // Tolerance for primal
   double primal_feasibility_tolerance;
@@ -441,6 +490,12 @@ class HDual {
   double Td;  // Tolerance for dual
   double dual_feasibility_tolerance;
   double dual_objective_value_upper_bound;
+  // Contribution of the cost perturbations and shifts to the updated
+  // dual objective value. It's recomputed in rebuild() and, unless
+  // PAMI is used, updated with the primal values and costs so that
+  // the exact dual objective value is known every iteration
+  double dual_objective_perturbation = 0;
+  bool track_dual_objective_perturbation = false;
 
   int solvePhase;
   int invertHint;
@@ -450,6 +505,10 @@ class HDual {
   HVector col_aq;
   HVector col_BFRT;
   HVector col_DSE;
+  bool work_vectors_from_pool = false;
+
+  int num_cost_reperturbation = 0;
+  const int max_num_cost_reperturbation = 10;
 
   HDualRow dualRow;
 
@@ -26,6 +26,20 @@ using std::fabs;
 using std::max;
 using std::swap;
 
+// Index of the lowest set bit of a nonzero word
+static inline int lowestSetBit(unsigned long long word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(word);
+#else
+  int bit = 0;
+  while (!(word & 1)) {
+    word >>= 1;
+    bit++;
+  }
+  return bit;
+#endif
+}
+
 void HMatrix::setup(int numCol_, int numRow_, const int* Astart_,
                     const int* Aindex_, const double* Avalue_,
                     const int* nonbasicFlag_) {
@@ -273,12 +287,28 @@ void HMatrix::priceByRowSparseResultWithSwitch(HVector& row_ap,
 void HMatrix::priceByRowDenseResult(HVector& row_ap, const HVector& row_ep,
                                     int from_i) const {
   // (Continue) standard row-wise PRICE
+  //
+  // Rather than scanning all numCol entries of the result to
+  // determine its nonzeros, the columns which may be nonzero are
+  // marked in a bitmap with one bit per column. The indices of
+  // nonzeros are then gathered - in increasing order, as for a full
+  // scan - by visiting only the set bits of nonzero words.
+  //
   // Alias
   int* ap_index = &row_ap.index[0];
   double* ap_array = &row_ap.array[0];
   const int ep_count = row_ep.count;
   const int* ep_index = &row_ep.index[0];
   const double* ep_array = &row_ep.array[0];
+  const int num_word = (numCol + 63) / 64;
+  vector<unsigned long long>& bitmap = row_ap.nonzero_bitmap;
+  if ((int)bitmap.size() < num_word) bitmap.assign(num_word, 0);
+  unsigned long long* ap_bitmap = &bitmap[0];
+  // Mark the nonzeros from any hyper-sparse PRICE
+  for (int i = 0; i < row_ap.count; i++) {
+    const int index = ap_index[i];
+    ap_bitmap[index >> 6] |= 1ull << (index & 63);
+  }
   // Computation
   for (int i = from_i; i < ep_count; i++) {
     int iRow = ep_index[i];
@@ -289,16 +319,26 @@ void HMatrix::priceByRowDenseResult(HVector& row_ap, const HVector& row_ep,
       double value1 = value0 + multiplier * ARvalue[k];
       ap_array[index] =
           (fabs(value1) < HIGHS_CONST_TINY) ? HIGHS_CONST_ZERO : value1;
+      ap_bitmap[index >> 6] |= 1ull << (index & 63);
     }
   }
-  // Determine indices of nonzeros in PRICE result
+  // Determine indices of nonzeros in PRICE result, clearing the
+  // bitmap as it is used
   int ap_count = 0;
-  for (int index = 0; index < numCol; index++) {
-    double value1 = ap_array[index];
-    if (fabs(value1) < HIGHS_CONST_TINY) {
-      ap_array[index] = 0;
-    } else {
-      ap_index[ap_count++] = index;
+  for (int iWord = 0; iWord < num_word; iWord++) {
+    unsigned long long word = ap_bitmap[iWord];
+    if (!word) continue;
+    ap_bitmap[iWord] = 0;
+    const int word_start = iWord << 6;
+    while (word) {
+      const int index = word_start + lowestSetBit(word);
+      word &= word - 1;
+      double value1 = ap_array[index];
+      if (fabs(value1) < HIGHS_CONST_TINY) {
+        ap_array[index] = 0;
+      } else {
+        ap_index[ap_count++] = index;
+      }
     }
   }
   row_ap.count = ap_count;
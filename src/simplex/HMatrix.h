@@ -145,7 +145,7 @@ class HMatrix {
    * @brief Density of result at which it is not worth maintaing
    * indices of nonzeros
    */
-  const double hyperPRICE = 0.10;
+  static constexpr double hyperPRICE = 0.10;
 
  private:
   int numCol;
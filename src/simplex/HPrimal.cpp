@@ -158,7 +158,8 @@ HighsStatus HPrimal::solve() {
   solvePhase = 2;
   assert(workHMO.scaled_model_status_ != HighsModelStatus::REACHED_TIME_LIMIT &&
          workHMO.scaled_model_status_ !=
-             HighsModelStatus::REACHED_ITERATION_LIMIT);
+             HighsModelStatus::REACHED_ITERATION_LIMIT &&
+         workHMO.scaled_model_status_ != HighsModelStatus::REACHED_INTERRUPT);
   analysis = &workHMO.simplex_analysis_;
   if (solvePhase == 2) {
     int it0 = workHMO.iteration_counts_.simplex;
@@ -835,7 +836,9 @@ bool HPrimal::bailout() {
     assert(workHMO.scaled_model_status_ ==
                HighsModelStatus::REACHED_TIME_LIMIT ||
            workHMO.scaled_model_status_ ==
-               HighsModelStatus::REACHED_ITERATION_LIMIT);
+               HighsModelStatus::REACHED_ITERATION_LIMIT ||
+           workHMO.scaled_model_status_ ==
+               HighsModelStatus::REACHED_INTERRUPT);
   } else if (workHMO.timer_.readRunHighsClock() > workHMO.options_.time_limit) {
     solve_bailout = true;
     workHMO.scaled_model_status_ = HighsModelStatus::REACHED_TIME_LIMIT;
@@ -843,6 +846,9 @@ bool HPrimal::bailout() {
              workHMO.options_.simplex_iteration_limit) {
     solve_bailout = true;
     workHMO.scaled_model_status_ = HighsModelStatus::REACHED_ITERATION_LIMIT;
+  } else if (workHMO.callback_.interruptRequested()) {
+    solve_bailout = true;
+    workHMO.scaled_model_status_ = HighsModelStatus::REACHED_INTERRUPT;
   }
   return solve_bailout;
 }
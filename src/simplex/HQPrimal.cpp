@@ -168,7 +168,17 @@ HighsStatus HQPrimal::solve() {
     int it0 = workHMO.iteration_counts_.simplex;
 
     analysis->simplexTimerStart(SimplexPrimalPhase2Clock);
+    if (simplex_info.perturbation_strategy ==
+        SIMPLEX_PERTURBATION_STRATEGY_ADAPTIVE)
+      perturbBounds();
     solvePhase2();
+    if (simplex_info.bounds_perturbed &&
+        workHMO.scaled_model_status_ == HighsModelStatus::OPTIMAL) {
+      // Remove the bound perturbation and solve again from the
+      // current basis, which may now be slightly primal infeasible
+      removeBoundPerturbation();
+      solvePhase2();
+    }
     analysis->simplexTimerStop(SimplexPrimalPhase2Clock);
 
     simplex_info.primal_phase2_iteration_count +=
@@ -423,6 +433,11 @@ void HQPrimal::primalRebuild() {
   }
 
   reportRebuild(sv_invertHint);
+  // Possibly call the user callback. Any interrupt is picked up by
+  // bailout()
+  if (workHMO.callback_.active())
+    simplexRebuildCallback(workHMO,
+                           simplex_info.updated_primal_objective_value);
 #ifdef HiGHSDEV
   if (simplex_info.analyse_rebuild_time) {
     int total_rebuilds =
@@ -1305,6 +1320,44 @@ void HQPrimal::devexUpdate() {
   analysis->simplexTimerStop(DevexUpdateWeightClock);
 }
 
+void HQPrimal::perturbBounds() {
+  // Only the bounds of basic variables are perturbed, so the values
+  // of nonbasic variables are unchanged and primal feasibility is
+  // maintained. Variables with the same ratio in CHUZR are then
+  // unlikely to tie, reducing the number of degenerate iterations
+  HighsSimplexInfo& simplex_info = workHMO.simplex_info_;
+  const vector<int>& basicIndex = workHMO.simplex_basis_.basicIndex_;
+  HighsRandom& random = workHMO.random_;
+  const double base =
+      5e-7 * simplex_info.primal_simplex_bound_perturbation_multiplier;
+  if (base <= 0) return;
+  const int num_row = workHMO.simplex_lp_.numRow_;
+  for (int iRow = 0; iRow < num_row; iRow++) {
+    const int iVar = basicIndex[iRow];
+    double& lower = simplex_info.workLower_[iVar];
+    double& upper = simplex_info.workUpper_[iVar];
+    // Don't perturb fixed variables
+    if (lower == upper) continue;
+    if (!highs_isInfinity(-lower))
+      lower -= (fabs(lower) + 1) * base * (1 + random.fraction());
+    if (!highs_isInfinity(upper))
+      upper += (fabs(upper) + 1) * base * (1 + random.fraction());
+    simplex_info.workRange_[iVar] = upper - lower;
+  }
+  simplex_info.bounds_perturbed = 1;
+}
+
+void HQPrimal::removeBoundPerturbation() {
+  HighsPrintMessage(workHMO.options_.output, workHMO.options_.message_level,
+                    ML_DETAILED, "primal-remove-bound-perturbation\n");
+  // Variables which have left the basis may be nonbasic at a
+  // perturbed bound, so reset the nonbasic values. The values of
+  // basic variables are recomputed in primalRebuild()
+  initialiseBound(workHMO);
+  initialiseValueAndNonbasicMove(workHMO);
+  workHMO.simplex_info_.bounds_perturbed = 0;
+}
+
 void HQPrimal::iterationAnalysisData() {
   //  HighsSolutionParams& scaled_solution_params =
   //  workHMO.scaled_solution_params_;
@@ -1347,6 +1400,9 @@ void HQPrimal::iterationAnalysis() {
   iterationAnalysisData();
   analysis->iterationReport();
 
+  // Record any degenerate iteration
+  if (analysis->stalling(workHMO.iteration_counts_)) analysis->resetStall();
+
 #ifdef HiGHSDEV
   analysis->iterationRecord();
 #endif
@@ -1367,7 +1423,9 @@ bool HQPrimal::bailout() {
     assert(workHMO.scaled_model_status_ ==
                HighsModelStatus::REACHED_TIME_LIMIT ||
            workHMO.scaled_model_status_ ==
-               HighsModelStatus::REACHED_ITERATION_LIMIT);
+               HighsModelStatus::REACHED_ITERATION_LIMIT ||
+           workHMO.scaled_model_status_ ==
+               HighsModelStatus::REACHED_INTERRUPT);
   } else if (workHMO.timer_.readRunHighsClock() > workHMO.options_.time_limit) {
     solve_bailout = true;
     workHMO.scaled_model_status_ = HighsModelStatus::REACHED_TIME_LIMIT;
@@ -1375,6 +1433,9 @@ bool HQPrimal::bailout() {
              workHMO.options_.simplex_iteration_limit) {
     solve_bailout = true;
     workHMO.scaled_model_status_ = HighsModelStatus::REACHED_ITERATION_LIMIT;
+  } else if (workHMO.callback_.interruptRequested()) {
+    solve_bailout = true;
+    workHMO.scaled_model_status_ = HighsModelStatus::REACHED_INTERRUPT;
   }
   return solve_bailout;
 }
@@ -60,6 +60,13 @@ class HQPrimal {
   void devexReset();
   void devexUpdate();
 
+  /**
+   * @brief Widen the bounds of basic variables so that ties in CHUZR
+   * are broken, and remove the perturbation once optimal
+   */
+  void perturbBounds();
+  void removeBoundPerturbation();
+
   /**
    * @brief Pass the data for the iteration analysis, report and rebuild report
    */
@@ -52,8 +52,11 @@ void setSimplexOptions(HighsModelObject& highs_model_object) {
   simplex_info.dual_edge_weight_strategy =
       options.simplex_dual_edge_weight_strategy;
   simplex_info.price_strategy = options.simplex_price_strategy;
+  simplex_info.perturbation_strategy = options.simplex_perturbation_strategy;
   simplex_info.dual_simplex_cost_perturbation_multiplier =
       options.dual_simplex_cost_perturbation_multiplier;
+  simplex_info.primal_simplex_bound_perturbation_multiplier =
+      options.primal_simplex_bound_perturbation_multiplier;
   simplex_info.factor_pivot_threshold = options.factor_pivot_threshold;
   simplex_info.update_limit = options.simplex_update_limit;
 
@@ -2135,7 +2138,9 @@ void initialiseCost(HighsModelObject& highs_model_object, int perturb) {
   initialisePhase2RowCost(highs_model_object);
   // See if we want to skip perturbation
   simplex_info.costs_perturbed = 0;
+  simplex_info.max_cost_perturbation = 0;
   if (perturb == 0 ||
+      simplex_info.perturbation_strategy == SIMPLEX_PERTURBATION_STRATEGY_OFF ||
       simplex_info.dual_simplex_cost_perturbation_multiplier == 0)
     return;
   simplex_info.costs_perturbed = 1;
@@ -2202,9 +2207,7 @@ void initialiseCost(HighsModelObject& highs_model_object, int perturb) {
     double xpert = (fabs(simplex_info.workCost_[i]) + 1) * base *
                    simplex_info.dual_simplex_cost_perturbation_multiplier *
                    (1 + simplex_info.numTotRandomValue_[i]);
-#ifdef HiGHSDEV
     const double previous_cost = simplex_info.workCost_[i];
-#endif
     if (lower <= -HIGHS_CONST_INF && upper >= HIGHS_CONST_INF) {
       // Free - no perturb
     } else if (upper >= HIGHS_CONST_INF) {  // Lower
@@ -2217,6 +2220,9 @@ void initialiseCost(HighsModelObject& highs_model_object, int perturb) {
     } else {
       // Fixed - no perturb
     }
+    simplex_info.max_cost_perturbation =
+        max(fabs(simplex_info.workCost_[i] - previous_cost),
+            simplex_info.max_cost_perturbation);
 #ifdef HiGHSDEV
     const double perturbation1 =
         fabs(simplex_info.workCost_[i] - previous_cost);
@@ -2575,10 +2581,10 @@ void computePrimal(HighsModelObject& highs_model_object) {
   HMatrix& matrix = highs_model_object.matrix_;
   HFactor& factor = highs_model_object.factor_;
   HighsSimplexAnalysis* analysis = &highs_model_object.simplex_analysis_;
+  HVectorPool& pool = highs_model_object.hvector_pool_;
   // Setup a local buffer for the values of basic variables
   HVector primal_col;
-  primal_col.setup(simplex_lp.numRow_);
-  primal_col.clear();
+  pool.acquire(primal_col, simplex_lp.numRow_);
   for (int i = 0; i < simplex_lp.numCol_ + simplex_lp.numRow_; i++) {
     if (simplex_basis.nonbasicFlag_[i] && simplex_info.workValue_[i] != 0) {
       matrix.collect_aj(primal_col, i, simplex_info.workValue_[i]);
@@ -2607,6 +2613,7 @@ void computePrimal(HighsModelObject& highs_model_object) {
     simplex_info.baseUpper_[i] = simplex_info.workUpper_[iCol];
   }
   debugComputePrimal(highs_model_object, debug_primal_rhs);
+  pool.release(primal_col);
   // Now have basic primals
   simplex_lp_status.has_basic_primal_values = true;
 }
@@ -2622,7 +2629,50 @@ void computeSimplexInfeasible(HighsModelObject& highs_model_object) {
   analysis.simplexTimerStop(ComputeDuIfsClock);
 }
 
+void simplexRebuildCallback(HighsModelObject& highs_model_object,
+                            const double objective_value) {
+  HighsCallback& callback = highs_model_object.callback_;
+  const HighsSimplexInfo& simplex_info = highs_model_object.simplex_info_;
+  HighsCallbackDataOut data_out;
+  HighsCallback::clearDataOut(data_out);
+  data_out.running_time = highs_model_object.timer_.readRunHighsClock();
+  data_out.simplex_iteration_count =
+      highs_model_object.iteration_counts_.simplex;
+  data_out.objective_function_value = objective_value;
+  if (simplex_info.run_quiet) {
+    // The infeasibilities are only computed in rebuild if the simplex
+    // solver isn't running quietly, so compute them just for the
+    // callback
+    double max_infeasibility;
+    computeSimplexPrimalInfeasible(
+        highs_model_object, data_out.num_primal_infeasibilities,
+        max_infeasibility, data_out.sum_primal_infeasibilities);
+    computeSimplexDualInfeasible(
+        highs_model_object, data_out.num_dual_infeasibilities,
+        max_infeasibility, data_out.sum_dual_infeasibilities);
+  } else {
+    data_out.num_primal_infeasibilities =
+        simplex_info.num_primal_infeasibilities;
+    data_out.sum_primal_infeasibilities =
+        simplex_info.sum_primal_infeasibilities;
+    data_out.num_dual_infeasibilities = simplex_info.num_dual_infeasibilities;
+    data_out.sum_dual_infeasibilities = simplex_info.sum_dual_infeasibilities;
+  }
+  callback.callbackAction(HIGHS_CALLBACK_SIMPLEX_REBUILD, data_out);
+}
+
 void computeSimplexPrimalInfeasible(HighsModelObject& highs_model_object) {
+  HighsSimplexInfo& simplex_info = highs_model_object.simplex_info_;
+  computeSimplexPrimalInfeasible(highs_model_object,
+                                 simplex_info.num_primal_infeasibilities,
+                                 simplex_info.max_primal_infeasibility,
+                                 simplex_info.sum_primal_infeasibilities);
+}
+
+void computeSimplexPrimalInfeasible(const HighsModelObject& highs_model_object,
+                                    int& num_primal_infeasibilities,
+                                    double& max_primal_infeasibility,
+                                    double& sum_primal_infeasibilities) {
   // Computes num/max/sum of primal infeasibliities according to the
   // simplex bounds. This is used to determine optimality in dual
   // phase 1 and dual phase 2, albeit using different bounds in
@@ -2632,12 +2682,6 @@ void computeSimplexPrimalInfeasible(HighsModelObject& highs_model_object) {
   const SimplexBasis& simplex_basis = highs_model_object.simplex_basis_;
   const double scaled_primal_feasibility_tolerance =
       highs_model_object.scaled_solution_params_.primal_feasibility_tolerance;
-  int& num_primal_infeasibilities =
-      highs_model_object.simplex_info_.num_primal_infeasibilities;
-  double& max_primal_infeasibility =
-      highs_model_object.simplex_info_.max_primal_infeasibility;
-  double& sum_primal_infeasibilities =
-      highs_model_object.simplex_info_.sum_primal_infeasibilities;
   num_primal_infeasibilities = 0;
   max_primal_infeasibility = 0;
   sum_primal_infeasibilities = 0;
@@ -2675,6 +2719,17 @@ void computeSimplexPrimalInfeasible(HighsModelObject& highs_model_object) {
 }
 
 void computeSimplexDualInfeasible(HighsModelObject& highs_model_object) {
+  HighsSimplexInfo& simplex_info = highs_model_object.simplex_info_;
+  computeSimplexDualInfeasible(highs_model_object,
+                               simplex_info.num_dual_infeasibilities,
+                               simplex_info.max_dual_infeasibility,
+                               simplex_info.sum_dual_infeasibilities);
+}
+
+void computeSimplexDualInfeasible(const HighsModelObject& highs_model_object,
+                                  int& num_dual_infeasibilities,
+                                  double& max_dual_infeasibility,
+                                  double& sum_dual_infeasibilities) {
   // Computes num/max/sum of dual infeasibilities in phase 1 and phase
   // 2 according to nonbasicMove. The bounds are only used to identify
   // free variables. Fixed variables are assumed to have
@@ -2687,12 +2742,6 @@ void computeSimplexDualInfeasible(HighsModelObject& highs_model_object) {
   // Possibly verify that nonbasicMove is correct for fixed variables
   debugFixedNonbasicMove(highs_model_object);
 
-  int& num_dual_infeasibilities =
-      highs_model_object.simplex_info_.num_dual_infeasibilities;
-  double& max_dual_infeasibility =
-      highs_model_object.simplex_info_.max_dual_infeasibility;
-  double& sum_dual_infeasibilities =
-      highs_model_object.simplex_info_.sum_dual_infeasibilities;
   num_dual_infeasibilities = 0;
   max_dual_infeasibility = 0;
   sum_dual_infeasibilities = 0;
@@ -2987,17 +3036,16 @@ void computeDual(HighsModelObject& highs_model_object) {
   HMatrix& matrix = highs_model_object.matrix_;
   HFactor& factor = highs_model_object.factor_;
 
+  HVectorPool& pool = highs_model_object.hvector_pool_;
   // Create a local buffer for the pi vector
   HVector dual_col;
-  dual_col.setup(simplex_lp.numRow_);
-  dual_col.clear();
+  pool.acquire(dual_col, simplex_lp.numRow_);
   for (int iRow = 0; iRow < simplex_lp.numRow_; iRow++) {
     const double value =
         simplex_info.workCost_[simplex_basis.basicIndex_[iRow]] +
         simplex_info.workShift_[simplex_basis.basicIndex_[iRow]];
     if (value) {
-      dual_col.count++;
-      dual_col.index[iRow] = iRow;
+      dual_col.index[dual_col.count++] = iRow;
       dual_col.array[iRow] = value;
     }
   }
@@ -3034,8 +3082,7 @@ void computeDual(HighsModelObject& highs_model_object) {
                                           analysis.dual_col_density);
     // Create a local buffer for the values of reduced costs
     HVector dual_row;
-    dual_row.setup(simplex_lp.numCol_);
-    dual_row.clear();
+    pool.acquire(dual_row, simplex_lp.numCol_);
 #ifdef HiGHSDEV
     double price_full_historical_density = 1;
     if (simplex_info.analyse_iterations)
@@ -3055,7 +3102,9 @@ void computeDual(HighsModelObject& highs_model_object) {
     // Possibly analyse the computed dual values
     debugComputeDual(highs_model_object, debug_previous_workDual,
                      debug_basic_costs, dual_col.array);
+    pool.release(dual_row);
   }
+  pool.release(dual_col);
   // Now have nonbasic duals
   simplex_lp_status.has_nonbasic_dual_values = true;
 }
@@ -3414,7 +3463,8 @@ HighsStatus getInfeasibilitiesAndNewTolerances(
       scaled_model_status !=
           HighsModelStatus::REACHED_DUAL_OBJECTIVE_VALUE_UPPER_BOUND &&
       scaled_model_status != HighsModelStatus::REACHED_TIME_LIMIT &&
-      scaled_model_status != HighsModelStatus::REACHED_ITERATION_LIMIT;
+      scaled_model_status != HighsModelStatus::REACHED_ITERATION_LIMIT &&
+      scaled_model_status != HighsModelStatus::REACHED_INTERRUPT;
 
   const double scaled_primal_feasibility_tolerance =
       scaled_solution_params.primal_feasibility_tolerance;
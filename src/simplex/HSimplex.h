@@ -163,12 +163,26 @@ void computePrimal(HighsModelObject& highs_model_object);
 void computeSimplexInfeasible(HighsModelObject& highs_model_object);
 void computeSimplexPrimalInfeasible(HighsModelObject& highs_model_object);
 void computeSimplexDualInfeasible(HighsModelObject& highs_model_object);
+// Compute the infeasibilities without storing them in simplex_info
+void computeSimplexPrimalInfeasible(const HighsModelObject& highs_model_object,
+                                    int& num_primal_infeasibilities,
+                                    double& max_primal_infeasibility,
+                                    double& sum_primal_infeasibilities);
+void computeSimplexDualInfeasible(const HighsModelObject& highs_model_object,
+                                  int& num_dual_infeasibilities,
+                                  double& max_dual_infeasibility,
+                                  double& sum_dual_infeasibilities);
 
 void computeDualInfeasibleWithFlips(HighsModelObject& highs_model_object);
 
 void computeSimplexLpDualInfeasible(HighsModelObject& highs_model_object);
 
 void copySimplexInfeasible(HighsModelObject& highs_model_object);
+
+// Fill in the callback data after a simplex rebuild and call the user
+// callback, which may request an interrupt
+void simplexRebuildCallback(HighsModelObject& highs_model_object,
+                            const double objective_value);
 void copySimplexDualInfeasible(HighsModelObject& highs_model_object);
 void copySimplexPrimalInfeasible(HighsModelObject& highs_model_object);
 
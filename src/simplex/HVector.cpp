@@ -29,6 +29,7 @@ void HVector::setup(int size_) {
   array.assign(size, 0);
   cwork.assign(size + 6400, 0);  // MAX invert
   iwork.assign(size * 4, 0);
+  nonzero_bitmap.assign((size + 63) / 64, 0);
 
   packCount = 0;
   packIndex.resize(size);
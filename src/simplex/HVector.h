@@ -49,6 +49,10 @@ class HVector {
   vector<int> iwork;   //!< integer working buffer for UPDATE
   HVector* next;       //!< Allows vectors to be linked for PAMI
 
+  // For PRICE
+  vector<unsigned long long>
+      nonzero_bitmap;  //!< Bitmap of possible nonzeros, all zero between uses
+
   /**
    * @brief Packing: Zero values in Vector.array which exceed HIGHS_CONST_TINY
    * in magnitude
@@ -0,0 +1,51 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file simplex/HVectorPool.cpp
+ * @brief
+ * @author Julian Hall, Ivet Galabova, Qi Huangfu and Michael Feldmeier
+ */
+#include "simplex/HVectorPool.h"
+
+#include <utility>
+
+void HVectorPool::acquire(HVector& vector, const int size) {
+  // Look for a free vector of the same dimension, since its storage
+  // is clear and can be used as it is
+  const int num_free = free_vectors.size();
+  for (int i = num_free - 1; i >= 0; i--) {
+    if (free_vectors[i].size != size) continue;
+    vector = std::move(free_vectors[i]);
+    if (i < num_free - 1) free_vectors[i] = std::move(free_vectors.back());
+    free_vectors.pop_back();
+    vector.packFlag = false;
+    vector.packCount = 0;
+    vector.syntheticTick = 0;
+    vector.next = 0;
+    num_reuse++;
+    return;
+  }
+  if (num_free) {
+    // Use the storage of a free vector of different dimension, which
+    // avoids some allocation when its capacity is sufficient
+    vector = std::move(free_vectors.back());
+    free_vectors.pop_back();
+  }
+  vector.setup(size);
+  num_allocate++;
+}
+
+void HVectorPool::release(HVector& vector) {
+  vector.clear();
+  free_vectors.push_back(std::move(vector));
+  vector.size = 0;
+  vector.count = 0;
+}
+
+void HVectorPool::clear() { free_vectors.clear(); }
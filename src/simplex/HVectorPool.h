@@ -0,0 +1,62 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2020 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file simplex/HVectorPool.h
+ * @brief Pool of HVector storage, reused between simplex solves
+ * @author Julian Hall, Ivet Galabova, Qi Huangfu and Michael Feldmeier
+ */
+#ifndef SIMPLEX_HVECTORPOOL_H_
+#define SIMPLEX_HVECTORPOOL_H_
+
+#include <vector>
+
+#include "simplex/HVector.h"
+
+using std::vector;
+
+/**
+ * @brief Pool of HVector storage for one HighsModelObject
+ *
+ * Work vectors that a solver would otherwise allocate (and zero) each
+ * time it is run - for example at every node of the MIP solver - are
+ * acquired from the pool and returned to it when the solver is done.
+ * Vectors are cleared when they are released, using their nonzero
+ * indices if possible, so a vector of the right size is acquired
+ * without any allocation or zeroing pass over its full length.
+ */
+class HVectorPool {
+ public:
+  /**
+   * @brief Set up vector with dimension size, taking storage from the
+   * pool if possible
+   */
+  void acquire(HVector& vector,  //!< Vector to be set up
+               const int size    //!< Dimension of the vector
+  );
+
+  /**
+   * @brief Clear vector and return its storage to the pool. The
+   * vector must be acquired again before it is used
+   */
+  void release(HVector& vector  //!< Vector to be returned to the pool
+  );
+
+  /**
+   * @brief Free all storage in the pool
+   */
+  void clear();
+
+  int num_allocate = 0;  //!< Number of vectors set up from scratch
+  int num_reuse = 0;     //!< Number of vectors set up from the pool
+
+ private:
+  vector<HVector> free_vectors;
+};
+
+#endif /* SIMPLEX_HVECTORPOOL_H_ */
@@ -111,6 +111,9 @@ void HighsSimplexAnalysis::setup(const HighsLp& lp, const HighsOptions& options,
   }
   num_devex_framework = 0;
 
+  stall_length = 0;
+  stall_length_limit = options.simplex_stall_length_limit;
+
   num_iteration_report_since_last_header = -1;
   num_invert_report_since_last_header = -1;
 
@@ -422,6 +425,24 @@ bool HighsSimplexAnalysis::switchToDevex() {
   return switch_to_devex;
 }
 
+bool HighsSimplexAnalysis::stalling(HighsIterationCounts& iteration_counts,
+                                    const double step_tolerance) {
+  // An iteration is degenerate if the step for the algorithm being
+  // used - dual for dual simplex and primal for primal simplex - is
+  // zero, or no larger than step_tolerance. Stalling is indicated by
+  // a long run of degenerate iterations.
+  const double step = dualAlgorithm() ? dual_step : primal_step;
+  if (fabs(step) > max(zero_step_tolerance, step_tolerance)) {
+    stall_length = 0;
+    return false;
+  }
+  iteration_counts.simplex_degenerate++;
+  stall_length++;
+  iteration_counts.simplex_max_stall =
+      max(stall_length, iteration_counts.simplex_max_stall);
+  return stall_length >= stall_length_limit;
+}
+
 bool HighsSimplexAnalysis::predictEndDensity(const int tran_stage_type,
                                              const double start_density,
                                              double& end_density) {
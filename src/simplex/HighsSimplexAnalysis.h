@@ -15,6 +15,7 @@
 #ifndef SIMPLEX_HIGHSSIMPLEXANALYSIS_H_
 #define SIMPLEX_HIGHSSIMPLEXANALYSIS_H_
 
+#include "lp_data/HStruct.h"
 #include "lp_data/HighsLp.h"
 #include "lp_data/HighsOptions.h"
 //#include "lp_data/HighsAnalysis.h"
@@ -99,6 +100,9 @@ class HighsSimplexAnalysis {
   void dualSteepestEdgeWeightError(const double computed_edge_weight,
                                    const double updated_edge_weight);
   bool switchToDevex();
+  bool stalling(HighsIterationCounts& iteration_counts,
+                const double step_tolerance = 0);
+  void resetStall() { stall_length = 0; }
   bool predictEndDensity(const int tran_stage_id, const double start_density,
                          double& end_density);
   void afterTranStage(const int tran_stage_id, const double start_density,
@@ -253,6 +257,12 @@ class HighsSimplexAnalysis {
   const double AnIterFracNumCostlyDseItbfSw = 0.05;   //!<
   double AnIterCostlyDseMeasure;
 
+  // Number of consecutive iterations with zero step, and the number
+  // which indicates stalling
+  int stall_length = 0;
+  int stall_length_limit = 0;
+  const double zero_step_tolerance = 1e-12;
+
   const double accept_weight_threshold = 0.25;
   const double weight_error_threshold = 4.0;
 
@@ -13,11 +13,15 @@
  */
 #include "simplex/HighsSimplexInterface.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "HConfig.h"
 #include "io/HMPSIO.h"
 #include "io/HighsIO.h"
 #include "lp_data/HighsLpUtils.h"
 #include "lp_data/HighsModelUtils.h"
+#include "simplex/HDual.h"
 #include "simplex/HSimplex.h"
 #include "simplex/HSimplexDebug.h"
 #include "util/HighsSort.h"
@@ -1201,6 +1205,411 @@ HighsStatus HighsSimplexInterface::setNonbasicStatus(
   return return_status;
 }
 
+HighsStatus HighsSimplexInterface::strongBranch(
+    const int num_candidate, const int* col, const double* value,
+    const int iteration_limit, HighsModelStatus* down_status,
+    double* down_objective, HighsModelStatus* up_status, double* up_objective,
+    int& iteration_count) {
+  HighsOptions& options = highs_model_object.options_;
+  HighsLp& simplex_lp = highs_model_object.simplex_lp_;
+  HighsScale& scale = highs_model_object.scale_;
+  HighsSimplexInfo& simplex_info = highs_model_object.simplex_info_;
+  HighsSimplexLpStatus& simplex_lp_status =
+      highs_model_object.simplex_lp_status_;
+  HighsModelStatus& scaled_model_status =
+      highs_model_object.scaled_model_status_;
+  iteration_count = 0;
+  if (!simplex_lp_status.valid || !simplex_lp_status.has_invert ||
+      simplex_lp_status.is_permuted || simplex_lp.numRow_ <= 0 ||
+      scaled_model_status != HighsModelStatus::OPTIMAL) {
+    HighsLogMessage(options.logfile, HighsMessageType::ERROR,
+                    "strongBranch: no optimal simplex basis and INVERT");
+    return HighsStatus::Error;
+  }
+  // Start the trials from a fresh INVERT so that no trial has to
+  // reinvert before its first iteration
+  if (simplex_info.update_count > 0 && computeFactor(highs_model_object)) {
+    HighsLogMessage(options.logfile, HighsMessageType::ERROR,
+                    "strongBranch: basis matrix is singular");
+    return HighsStatus::Error;
+  }
+  // Save the optimal basis and the simplex data that the dual simplex
+  // solver modifies. Updates change the INVERT in place, so it's
+  // restored by reinverting the optimal basis after any trial that
+  // changes it
+  SimplexBasis& simplex_basis = highs_model_object.simplex_basis_;
+  HMatrix& matrix = highs_model_object.matrix_;
+  const int numCol = simplex_lp.numCol_;
+  const int numRow = simplex_lp.numRow_;
+  SimplexBasis save_simplex_basis = simplex_basis;
+  const std::vector<int> optimal_basicIndex = simplex_basis.basicIndex_;
+  std::vector<double>* work_array[] = {
+      &simplex_info.workCost_,  &simplex_info.workDual_,
+      &simplex_info.workShift_, &simplex_info.workLower_,
+      &simplex_info.workUpper_, &simplex_info.workRange_,
+      &simplex_info.workValue_, &simplex_info.baseLower_,
+      &simplex_info.baseUpper_, &simplex_info.baseValue_};
+  const int num_work_array = sizeof(work_array) / sizeof(work_array[0]);
+  // The last three work arrays are indexed by the rows of the basis
+  const int num_base_array = 3;
+  std::vector<std::vector<double>> save_work_array(num_work_array);
+  for (int i = 0; i < num_work_array; i++)
+    save_work_array[i] = *work_array[i];
+  const int save_allow_cost_perturbation = simplex_info.allow_cost_perturbation;
+  const int save_costs_perturbed = simplex_info.costs_perturbed;
+  const double save_max_cost_perturbation = simplex_info.max_cost_perturbation;
+  const double save_dual_objective_value = simplex_info.dual_objective_value;
+  const double save_updated_dual_objective_value =
+      simplex_info.updated_dual_objective_value;
+  const int save_num_primal_infeasibilities =
+      simplex_info.num_primal_infeasibilities;
+  const double save_max_primal_infeasibility =
+      simplex_info.max_primal_infeasibility;
+  const double save_sum_primal_infeasibilities =
+      simplex_info.sum_primal_infeasibilities;
+  const int save_num_dual_infeasibilities =
+      simplex_info.num_dual_infeasibilities;
+  const double save_max_dual_infeasibility =
+      simplex_info.max_dual_infeasibility;
+  const double save_sum_dual_infeasibilities =
+      simplex_info.sum_dual_infeasibilities;
+  const HighsSimplexLpStatus save_simplex_lp_status = simplex_lp_status;
+  const HighsIterationCounts save_iteration_counts =
+      highs_model_object.iteration_counts_;
+  const HighsSolutionParams save_scaled_solution_params =
+      highs_model_object.scaled_solution_params_;
+  const int save_iteration_limit = options.simplex_iteration_limit;
+  if (iteration_limit < save_iteration_limit - save_iteration_counts.simplex)
+    options.simplex_iteration_limit =
+        save_iteration_counts.simplex + iteration_limit;
+
+  HDual dual_solver(highs_model_object);
+  bool stop = false;
+  bool singular = false;
+  for (int ix = 0; ix < num_candidate; ix++) {
+    down_status[ix] = HighsModelStatus::NOTSET;
+    up_status[ix] = HighsModelStatus::NOTSET;
+    down_objective[ix] = HIGHS_CONST_INF;
+    up_objective[ix] = HIGHS_CONST_INF;
+    if (stop) continue;
+    const int iCol = col[ix];
+    assert(iCol >= 0 && iCol < numCol);
+    const double col_scale = scale.is_scaled_ ? scale.col_[iCol] : 1;
+    const double lower = simplex_lp.colLower_[iCol];
+    const double upper = simplex_lp.colUpper_[iCol];
+    for (const bool up : {false, true}) {
+      if (up) {
+        simplex_lp.colLower_[iCol] = std::ceil(value[ix]) / col_scale;
+      } else {
+        simplex_lp.colUpper_[iCol] = std::floor(value[ix]) / col_scale;
+      }
+      // Tightening a bound preserves dual feasibility, so the trial
+      // starts in phase 2 with the new bound and primal values. Unit
+      // dual edge weights are used rather than computing them afresh,
+      // after undoing any switch from DSE to Devex in the previous
+      // trial. Devex weights are initialised by the solver
+      initialiseBound(highs_model_object);
+      initialiseValueAndNonbasicMove(highs_model_object);
+      updateSimplexLpStatus(simplex_lp_status, LpAction::NEW_BOUNDS);
+      dual_solver.options();
+      dual_solver.dualRHS.workEdWt.assign(numRow, 1);
+      simplex_lp_status.has_dual_steepest_edge_weights =
+          dual_solver.dual_edge_weight_mode != DualEdgeWeightMode::DEVEX;
+      HighsModelStatus& status = up ? up_status[ix] : down_status[ix];
+      if (dual_solver.solve() == HighsStatus::Error) {
+        status = HighsModelStatus::SOLVE_ERROR;
+      } else {
+        status = scaled_model_status;
+        if (status == HighsModelStatus::OPTIMAL ||
+            status == HighsModelStatus::REACHED_ITERATION_LIMIT) {
+          double& objective = up ? up_objective[ix] : down_objective[ix];
+          objective = ((int)simplex_lp.sense_) *
+                      simplex_info.updated_dual_objective_value;
+        }
+      }
+      iteration_count += highs_model_object.iteration_counts_.simplex -
+                         save_iteration_counts.simplex;
+      // Backtrack to the optimal basis. The row-wise matrix is
+      // restored by moving the columns whose status has changed back
+      // into their partition: HMatrix::update ignores logicals, so
+      // numCol stands for no column
+      simplex_lp.colLower_[iCol] = lower;
+      simplex_lp.colUpper_[iCol] = upper;
+      for (int iVar = 0; iVar < numCol; iVar++) {
+        const int nonbasic = save_simplex_basis.nonbasicFlag_[iVar];
+        if (simplex_basis.nonbasicFlag_[iVar] == nonbasic) continue;
+        if (nonbasic) {
+          matrix.update(numCol, iVar);
+        } else {
+          matrix.update(iVar, numCol);
+        }
+      }
+      const bool reinvert =
+          simplex_info.update_count > 0 ||
+          simplex_basis.basicIndex_ != save_simplex_basis.basicIndex_;
+      simplex_basis = save_simplex_basis;
+      simplex_lp_status = save_simplex_lp_status;
+      highs_model_object.iteration_counts_ = save_iteration_counts;
+      highs_model_object.scaled_solution_params_ = save_scaled_solution_params;
+      scaled_model_status = HighsModelStatus::OPTIMAL;
+      if (reinvert) {
+        // The optimal basis was nonsingular, but INVERT may reorder it
+        singular = computeFactor(highs_model_object) > 0;
+        save_simplex_basis.basicIndex_ = simplex_basis.basicIndex_;
+      }
+      if (singular || status == HighsModelStatus::REACHED_TIME_LIMIT ||
+          status == HighsModelStatus::REACHED_INTERRUPT) {
+        stop = true;
+        break;
+      }
+    }
+  }
+  options.simplex_iteration_limit = save_iteration_limit;
+  if (singular) {
+    HighsLogMessage(options.logfile, HighsMessageType::ERROR,
+                    "strongBranch: optimal basis matrix is singular");
+    updateSimplexLpStatus(simplex_lp_status, LpAction::NEW_BASIS);
+    scaled_model_status = HighsModelStatus::NOTSET;
+    return HighsStatus::Error;
+  }
+  // Restore the optimal simplex data, gathering the bounds and values
+  // of the basic variables according to any reordering of the basis
+  for (int i = 0; i < num_work_array - num_base_array; i++)
+    *work_array[i] = save_work_array[i];
+  const std::vector<int>& basicIndex = simplex_basis.basicIndex_;
+  std::vector<int> optimal_row(numCol + numRow, -1);
+  for (int iRow = 0; iRow < numRow; iRow++)
+    optimal_row[optimal_basicIndex[iRow]] = iRow;
+  for (int i = num_work_array - num_base_array; i < num_work_array; i++) {
+    std::vector<double>& base_array = *work_array[i];
+    for (int iRow = 0; iRow < numRow; iRow++)
+      base_array[iRow] = save_work_array[i][optimal_row[basicIndex[iRow]]];
+  }
+  simplex_info.allow_cost_perturbation = save_allow_cost_perturbation;
+  simplex_info.costs_perturbed = save_costs_perturbed;
+  simplex_info.max_cost_perturbation = save_max_cost_perturbation;
+  simplex_info.dual_objective_value = save_dual_objective_value;
+  simplex_info.updated_dual_objective_value =
+      save_updated_dual_objective_value;
+  simplex_info.num_primal_infeasibilities = save_num_primal_infeasibilities;
+  simplex_info.max_primal_infeasibility = save_max_primal_infeasibility;
+  simplex_info.sum_primal_infeasibilities = save_sum_primal_infeasibilities;
+  simplex_info.num_dual_infeasibilities = save_num_dual_infeasibilities;
+  simplex_info.max_dual_infeasibility = save_max_dual_infeasibility;
+  simplex_info.sum_dual_infeasibilities = save_sum_dual_infeasibilities;
+  return HighsStatus::OK;
+}
+
+HighsStatus HighsSimplexInterface::branchingPenalty(const int col,
+                                                   const double value,
+                                                   double& down_penalty,
+                                                   double& up_penalty) {
+  HighsLp& simplex_lp = highs_model_object.simplex_lp_;
+  HighsScale& scale = highs_model_object.scale_;
+  HighsSimplexInfo& simplex_info = highs_model_object.simplex_info_;
+  HighsSimplexLpStatus& simplex_lp_status =
+      highs_model_object.simplex_lp_status_;
+  SimplexBasis& simplex_basis = highs_model_object.simplex_basis_;
+  down_penalty = 0;
+  up_penalty = 0;
+  if (!simplex_lp_status.valid || !simplex_lp_status.has_invert ||
+      simplex_lp_status.is_permuted || simplex_lp.numRow_ <= 0 ||
+      highs_model_object.scaled_model_status_ != HighsModelStatus::OPTIMAL)
+    return HighsStatus::Error;
+  const int numCol = simplex_lp.numCol_;
+  const int numRow = simplex_lp.numRow_;
+  assert(col >= 0 && col < numCol);
+  if (simplex_basis.nonbasicFlag_[col]) return HighsStatus::Error;
+  int row_out = -1;
+  for (int iRow = 0; iRow < numRow; iRow++) {
+    if (simplex_basis.basicIndex_[iRow] == col) {
+      row_out = iRow;
+      break;
+    }
+  }
+  if (row_out < 0) return HighsStatus::Error;
+
+  // Form the tableau row of col: row_ep is the row of B^{-1}, giving
+  // the entries for the logicals, and row_ap is row_ep^TA
+  HVector row_ep;
+  HVector row_ap;
+  row_ep.setup(numRow);
+  row_ap.setup(numCol);
+  row_ep.clear();
+  row_ep.count = 1;
+  row_ep.index[0] = row_out;
+  row_ep.array[row_out] = 1;
+  const double expected_density = 1;
+  highs_model_object.factor_.btran(row_ep, expected_density);
+  row_ap.clear();
+  highs_model_object.matrix_.priceByColumn(row_ap, row_ep);
+
+  // Moving a nonbasic variable in its feasible direction by t changes
+  // the basic variable by -alpha*move*t and the objective by
+  // dual*move*t, so the cheapest rate of decreasing (increasing) col
+  // is the minimum ratio over those with alpha*move > 0 (< 0). Free
+  // nonbasic variables can move in either direction.
+  // Entries of the tableau row aren't ignored if they are small, as
+  // that could only raise the penalties above valid bounds
+  double min_down_ratio = HIGHS_CONST_INF;
+  double min_up_ratio = HIGHS_CONST_INF;
+  for (int iVar = 0; iVar < numCol + numRow; iVar++) {
+    if (!simplex_basis.nonbasicFlag_[iVar]) continue;
+    if (simplex_info.workLower_[iVar] == simplex_info.workUpper_[iVar])
+      continue;
+    const double alpha =
+        iVar < numCol ? row_ap.array[iVar] : row_ep.array[iVar - numCol];
+    if (!alpha) continue;
+    const int move = simplex_basis.nonbasicMove_[iVar];
+    // Dual infeasibilities within the tolerance are treated as zero
+    const double dual =
+        move ? std::max(simplex_info.workDual_[iVar] * move, 0.0) : 0.0;
+    const double ratio = dual / std::fabs(alpha);
+    if (move == 0 || alpha * move > 0)
+      min_down_ratio = std::min(ratio, min_down_ratio);
+    if (move == 0 || alpha * move < 0)
+      min_up_ratio = std::min(ratio, min_up_ratio);
+  }
+  // The bound changes in the scaled LP, and the objective changes in
+  // the unscaled LP
+  const double col_scale = scale.is_scaled_ ? scale.col_[col] : 1;
+  const double cost_scale = scale.cost_;
+  if (min_down_ratio < HIGHS_CONST_INF)
+    down_penalty = (value - std::floor(value)) / col_scale * min_down_ratio *
+                   cost_scale;
+  if (min_up_ratio < HIGHS_CONST_INF)
+    up_penalty =
+        (std::ceil(value) - value) / col_scale * min_up_ratio * cost_scale;
+  return HighsStatus::OK;
+}
+
+bool HighsSimplexInterface::prepareResolveDual() {
+  HighsLp& simplex_lp = highs_model_object.simplex_lp_;
+  HighsSimplexInfo& simplex_info = highs_model_object.simplex_info_;
+  HighsSimplexLpStatus& simplex_lp_status =
+      highs_model_object.simplex_lp_status_;
+  SimplexBasis& simplex_basis = highs_model_object.simplex_basis_;
+  HMatrix& matrix = highs_model_object.matrix_;
+  const int numTot = simplex_lp.numCol_ + simplex_lp.numRow_;
+  // The simplex LP must have been solved before, so that it's scaled
+  // and the work arrays exist
+  if (!simplex_lp_status.valid || simplex_lp_status.is_dualised ||
+      simplex_lp_status.is_permuted || simplex_lp.numRow_ <= 0 ||
+      (int)simplex_info.workCost_.size() != numTot)
+    return false;
+  if (!simplex_lp_status.has_basis || !simplex_lp_status.has_invert) {
+    // A new HiGHS basis has been set, so form the simplex basis and
+    // its INVERT
+    if (!simplex_lp_status.has_basis && !highs_model_object.basis_.valid_)
+      return false;
+    const bool only_from_known_basis = true;
+    if (initialiseSimplexLpBasisAndFactor(highs_model_object,
+                                          only_from_known_basis)) {
+      // Leave the HiGHS basis to be handled by a full solve
+      invalidateSimplexLpBasis(simplex_lp_status);
+      return false;
+    }
+  }
+  if (!simplex_lp_status.has_matrix_col_wise ||
+      !simplex_lp_status.has_matrix_row_wise) {
+    matrix.setup(simplex_lp.numCol_, simplex_lp.numRow_, &simplex_lp.Astart_[0],
+                 &simplex_lp.Aindex_[0], &simplex_lp.Avalue_[0],
+                 &simplex_basis.nonbasicFlag_[0]);
+    simplex_lp_status.has_matrix_col_wise = true;
+    simplex_lp_status.has_matrix_row_wise = true;
+  }
+  return true;
+}
+
+HighsStatus HighsSimplexInterface::resolveDual() {
+  HighsOptions& options = highs_model_object.options_;
+  HighsSimplexInfo& simplex_info = highs_model_object.simplex_info_;
+  HighsSimplexLpStatus& simplex_lp_status =
+      highs_model_object.simplex_lp_status_;
+  HighsModelStatus& scaled_model_status =
+      highs_model_object.scaled_model_status_;
+  HighsModelStatus& unscaled_model_status =
+      highs_model_object.unscaled_model_status_;
+  HighsSolutionParams& scaled_solution_params =
+      highs_model_object.scaled_solution_params_;
+  HighsSolutionParams& unscaled_solution_params =
+      highs_model_object.unscaled_solution_params_;
+  if (!prepareResolveDual()) {
+    HighsLogMessage(options.logfile, HighsMessageType::ERROR,
+                    "resolveDual: no simplex basis and INVERT");
+    return HighsStatus::Error;
+  }
+  resetModelStatusAndSolutionParams(highs_model_object);
+  simplex_lp_status.has_dual_ray = false;
+  simplex_lp_status.has_primal_ray = false;
+  // Only the bounds have changed, so the INVERT, matrix and dual edge
+  // weights remain valid. The work bounds and nonbasic values are set
+  // from the new bounds, and the primal and dual values are computed
+  // by the dual simplex solver
+  initialiseBound(highs_model_object);
+  initialiseValueAndNonbasicMove(highs_model_object);
+  HDual dual_solver(highs_model_object);
+  dual_solver.options();
+  if (dual_solver.solve() == HighsStatus::Error) {
+    scaled_model_status = HighsModelStatus::SOLVE_ERROR;
+    return HighsStatus::Error;
+  }
+  if (scaled_model_status == HighsModelStatus::OPTIMAL &&
+      simplex_info.num_primal_infeasibilities) {
+    // As in runSimplexSolver(), optimality with primal
+    // infeasibilities may be claimed, so try again
+    if (dual_solver.solve() == HighsStatus::Error) {
+      scaled_model_status = HighsModelStatus::SOLVE_ERROR;
+      return HighsStatus::Error;
+    }
+    if (scaled_model_status == HighsModelStatus::OPTIMAL &&
+        simplex_info.num_primal_infeasibilities)
+      scaled_model_status = HighsModelStatus::NOTSET;
+  }
+  computeSimplexInfeasible(highs_model_object);
+  copySimplexInfeasible(highs_model_object);
+  scaled_solution_params.objective_function_value =
+      simplex_info.primal_objective_value;
+
+  if (scaled_model_status == HighsModelStatus::OPTIMAL) {
+    scaled_solution_params.primal_status =
+        PrimalDualStatus::STATUS_FEASIBLE_POINT;
+    scaled_solution_params.dual_status =
+        PrimalDualStatus::STATUS_FEASIBLE_POINT;
+    if (highs_model_object.scale_.is_scaled_) {
+      // Determine whether the unscaled LP is also solved to the
+      // required tolerances. If not, the unscaled model status is
+      // left unset, as in tryToSolveUnscaledLp()
+      double new_primal_feasibility_tolerance;
+      double new_dual_feasibility_tolerance;
+      if (getNewInfeasibilityTolerancesFromSimplexBasicSolution(
+              highs_model_object, unscaled_solution_params,
+              new_primal_feasibility_tolerance,
+              new_dual_feasibility_tolerance) == HighsStatus::Error)
+        return HighsStatus::Error;
+      if (unscaled_solution_params.num_primal_infeasibilities == 0 &&
+          unscaled_solution_params.num_dual_infeasibilities == 0) {
+        unscaled_model_status = HighsModelStatus::OPTIMAL;
+        unscaled_solution_params.primal_status =
+            PrimalDualStatus::STATUS_FEASIBLE_POINT;
+        unscaled_solution_params.dual_status =
+            PrimalDualStatus::STATUS_FEASIBLE_POINT;
+      }
+    } else {
+      unscaled_model_status = scaled_model_status;
+      unscaled_solution_params = scaled_solution_params;
+    }
+  } else {
+    unscaled_model_status = scaled_model_status;
+    invalidateSolutionInfeasibilityParams(scaled_solution_params);
+  }
+  convertSimplexToHighsSolution();
+  convertSimplexToHighsBasis();
+  copySolutionObjectiveParams(scaled_solution_params,
+                              unscaled_solution_params);
+  return highsStatusFromHighsModelStatus(scaled_model_status);
+}
+
 // Get the dual ray
 HighsStatus HighsSimplexInterface::getDualRay(bool& has_dual_ray,
                                               double* dual_ray_value) {
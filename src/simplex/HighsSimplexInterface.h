@@ -99,6 +99,53 @@ class HighsSimplexInterface {
                          int* solution_num_nz, int* solution_nz_indices,
                          bool transpose = false);
 
+  /**
+   * @brief Strong branching from an optimal basis: for each candidate
+   * column, perform at most iteration_limit dual simplex iterations
+   * with its upper bound reduced to floor(value) and then with its
+   * lower bound raised to ceil(value). Each trial starts from unit
+   * dual edge weights. The basis and simplex data are restored after
+   * each trial, and the basis is reinverted if the trial changed
+   * it. The objective of each trial is the dual objective value when
+   * it stopped.
+   */
+  HighsStatus strongBranch(const int num_candidate, const int* col,
+                           const double* value, const int iteration_limit,
+                           HighsModelStatus* down_status,
+                           double* down_objective, HighsModelStatus* up_status,
+                           double* up_objective, int& iteration_count);
+
+  /**
+   * @brief Lower bounds on the increase in the objective when the
+   * basic column col with fractional value is branched on, from an
+   * optimal basis. They are the objective changes of the first dual
+   * simplex iteration after the upper bound is reduced to
+   * floor(value), or the lower bound raised to ceil(value), given by
+   * a dual ratio test on the tableau row of col. A child with no
+   * column to enter the basis has a penalty of zero, since the test
+   * isn't relied upon to prove infeasibility.
+   */
+  HighsStatus branchingPenalty(const int col, const double value,
+                               double& down_penalty, double& up_penalty);
+
+  /**
+   * @brief Ensure that the simplex LP has a basis, INVERT and matrix
+   * that resolveDual() can start from, forming them from any new
+   * HiGHS basis. Returns false if the simplex LP hasn't been solved
+   * before, or the HiGHS basis is singular
+   */
+  bool prepareResolveDual();
+
+  /**
+   * @brief Re-solve the simplex LP with the dual simplex method after
+   * changes to column bounds, starting from the current simplex
+   * basis, INVERT, matrix and dual edge weights. Unlike
+   * solveLpSimplex(), no transition to a basis and solution is
+   * performed, so prepareResolveDual() must succeed. The HiGHS
+   * solution and basis of the model object are set on return
+   */
+  HighsStatus resolveDual();
+
   /**
    * @brief Convert a SCIP baseStat for columns and rows to HiGHS basis
    * Postive  return value k implies invalid basis status for column k-1
@@ -109,6 +109,14 @@ enum SimplexPrimalEdgeWeightStrategy {
       SIMPLEX_PRIMAL_EDGE_WEIGHT_STRATEGY_DEVEX
 };
 
+enum SimplexPerturbationStrategy {
+  SIMPLEX_PERTURBATION_STRATEGY_MIN = 0,
+  SIMPLEX_PERTURBATION_STRATEGY_OFF = SIMPLEX_PERTURBATION_STRATEGY_MIN,
+  SIMPLEX_PERTURBATION_STRATEGY_COST,      // Dual: perturb costs at start
+  SIMPLEX_PERTURBATION_STRATEGY_ADAPTIVE,  // Also re-perturb when stalling
+  SIMPLEX_PERTURBATION_STRATEGY_MAX = SIMPLEX_PERTURBATION_STRATEGY_ADAPTIVE
+};
+
 enum SimplexPriceStrategy {
   SIMPLEX_PRICE_STRATEGY_MIN = 0,
   SIMPLEX_PRICE_STRATEGY_COL = SIMPLEX_PRICE_STRATEGY_MIN,
@@ -135,7 +135,9 @@ struct HighsSimplexInfo {
   int primal_edge_weight_strategy;
   int price_strategy;
 
+  int perturbation_strategy;
   double dual_simplex_cost_perturbation_multiplier;
+  double primal_simplex_bound_perturbation_multiplier;
   double factor_pivot_threshold;
   int update_limit;
 
@@ -163,6 +165,9 @@ struct HighsSimplexInfo {
   // Simplex runtime information
   int allow_cost_perturbation = true;
   int costs_perturbed = 0;
+  // Largest change made to any cost by perturbation
+  double max_cost_perturbation = 0;
+  int bounds_perturbed = 0;
 
   int num_primal_infeasibilities = -1;
   double max_primal_infeasibility;
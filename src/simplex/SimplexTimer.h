@@ -36,6 +36,8 @@ enum iClockSimplex {
   IteratePrimalClock,         //!< Second level timing of primal update
   IterateDevexIzClock,        //!< Second level timing of initialise Devex
   IteratePivotsClock,         //!< Second level timing of pivoting
+  IterateDuObjBoundClock,     //!< Second level timing of dual objective
+                              //!< bound test
 
   initialiseSimplexLpBasisAndFactorClock,  //!< initialise Simplex LP, its basis
                                            //!< and factor
@@ -128,6 +130,7 @@ class SimplexTimer {
     clock[IteratePrimalClock] = timer.clock_def("PRIMAL", "UPR");
     clock[IterateDevexIzClock] = timer.clock_def("DEVEX_IZ", "DVI");
     clock[IteratePivotsClock] = timer.clock_def("PIVOTS", "PIV");
+    clock[IterateDuObjBoundClock] = timer.clock_def("DU_OBJ_BOUND", "OBB");
     clock[initialiseSimplexLpBasisAndFactorClock] =
         timer.clock_def("IZ_SIMPLEX_LP_DEF", "ISD");
     clock[allocateSimplexArraysClock] =
@@ -241,7 +244,8 @@ class SimplexTimer {
     std::vector<int> simplex_clock_list{
         IterateDualRebuildClock, IterateChuzrClock,   IterateChuzcClock,
         IterateFtranClock,       IterateVerifyClock,  IterateDualClock,
-        IteratePrimalClock,      IterateDevexIzClock, IteratePivotsClock};
+        IteratePrimalClock,      IterateDevexIzClock, IteratePivotsClock,
+        IterateDuObjBoundClock};
     reportSimplexClockList("SimplexOuter", simplex_clock_list,
                            simplex_timer_clock);
   };